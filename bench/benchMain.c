@@ -0,0 +1,443 @@
+/*! @file benchMain.c
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+/*
+ * Benchmark firmware for the drawing functions. It runs under simavr, counts the cycles of every call with Timer1 and
+ * writes one CSV line per measurement to the simavr console register:
+ *
+ * name,param,cycles,pixels,cycles_per_pixel
+ *
+ * The cycles are corrected by the overhead of an empty measurement. Pixels is 0 for calls without a fixed pixel count,
+ * cycles_per_pixel is left empty then and printed with two decimals otherwise. The ram copy is cleared before every call, so every call starts with
+ * the same content. The display itself is never touched.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <avr/sleep.h>
+#include <simavr/avr/avr_mcu_section.h>
+#include "../sys_src/platform.h"
+#include "../lcd_src/dogm128-graphic.h"
+#include "../lcd_src/drawing/drawingInclude.h"
+#include "../lcd_src/drawing/drawingNumbers.h"
+
+AVR_MCU(F_CPU, "atmega644p");
+AVR_MCU_SIMAVR_CONSOLE(&GPIOR0);
+
+static volatile uint16_t bench_overflows;
+static uint32_t bench_overhead;
+
+PLATFORM_ISR(TIMER1_OVF_vect) {
+    bench_overflows++;
+}
+
+static void bench_putChar(char c) {
+    GPIOR0 = (uint8_t) c;
+}
+
+static void bench_printP(const char* string) {
+    char c;
+    while ((c = (char) pgm_read_byte(string++))) {
+        bench_putChar(c);
+    }
+}
+
+static void bench_printNumber(uint32_t number) {
+    char string[11];
+    ultoa(number, string, 10);
+    for (char* pos = string; *pos; pos++) {
+        bench_putChar(*pos);
+    }
+}
+
+static inline void bench_start(void) {
+    TCCR1B = 0;
+    TCNT1 = 0;
+    bench_overflows = 0;
+    TIFR1 = (1 << TOV1);
+    TCCR1B = (1 << CS10);
+}
+
+static inline uint32_t bench_stop(void) {
+    TCCR1B = 0;
+    uint16_t count = TCNT1;
+    uint32_t overflows = bench_overflows;
+
+    // overflow not served yet
+    if (TIFR1 & (1 << TOV1)) {
+        overflows++;
+    }
+    return (overflows << 16) + count;
+}
+
+/*! @brief print cycles and cycles per pixel
+ *
+ * @param cycles    measured cycles with overhead
+ * @param pixels    pixels changed by the call; 0 if not applicable
+ *
+ * This function prints the end of a CSV line.
+ */
+static void bench_printCycles(uint32_t cycles, uint16_t pixels) {
+    cycles = (cycles > bench_overhead) ? cycles - bench_overhead : 0;
+
+    bench_printNumber(cycles);
+    bench_putChar(',');
+    bench_printNumber(pixels);
+    bench_putChar(',');
+    if (pixels) {
+        uint32_t perPixel = (cycles * 100 + pixels / 2) / pixels;
+        bench_printNumber(perPixel / 100);
+        bench_putChar('.');
+        bench_putChar((char) ('0' + (perPixel / 10) % 10));
+        bench_putChar((char) ('0' + perPixel % 10));
+    }
+    bench_putChar('\n');
+}
+
+/*! @brief print one CSV line
+ *
+ * @param name      function name in flash
+ * @param param     size, alignment or type of the measurement in flash
+ * @param cycles    measured cycles with overhead
+ * @param pixels    pixels changed by the call; 0 if not applicable
+ */
+static void bench_report(const char* name, const char* param, uint32_t cycles, uint16_t pixels) {
+    bench_printP(name);
+    bench_putChar(',');
+    bench_printP(param);
+    bench_putChar(',');
+    bench_printCycles(cycles, pixels);
+}
+
+static const char bench_typeSet[] PROGMEM = "_SET";
+static const char bench_typeAdd[] PROGMEM = "_ADD";
+static const char bench_typeClear[] PROGMEM = "_CLEAR";
+static const char bench_typeInvert[] PROGMEM = "_INVERT";
+
+/*! @brief print one CSV line of a sized call
+ *
+ * @param name      function name in flash
+ * @param type      draw type, appended to the name
+ * @param width     width of the drawn area
+ * @param height    height of the drawn area
+ * @param y         vertical start position, shows the alignment to the pages
+ * @param cycles    measured cycles with overhead
+ *
+ * The parameter is printed as <width>x<height>_y<y>, the pixels are width * height.
+ */
+static void bench_reportSized(const char* name, dogmGraphic_drawType_t type, uint8_t width, uint8_t height,
+                              uint8_t y, uint32_t cycles) {
+    bench_printP(name);
+    switch (type) {
+        case DOGM_ADD:
+            bench_printP(bench_typeAdd);
+            break;
+        case DOGM_CLEAR:
+            bench_printP(bench_typeClear);
+            break;
+        case DOGM_INVERT:
+            bench_printP(bench_typeInvert);
+            break;
+        default:
+        case DOGM_SET:
+            bench_printP(bench_typeSet);
+            break;
+    }
+    bench_putChar(',');
+    bench_printNumber(width);
+    bench_putChar('x');
+    bench_printNumber(height);
+    bench_printP(PSTR("_y"));
+    bench_printNumber(y);
+    bench_putChar(',');
+    bench_printCycles(cycles, (uint16_t) width * height);
+}
+
+/*! @brief measure one call
+ *
+ * The ram copy is cleared outside of the measurement, so every call starts with the same content.
+ */
+#define BENCH(name, param, pixels, call)                                    \
+    do {                                                                    \
+        dogmGraphic_clearWholeDisplay();                                    \
+        bench_start();                                                      \
+        call;                                                               \
+        uint32_t cycles = bench_stop();                                     \
+        bench_report(PSTR(name), PSTR(param), cycles, (pixels));            \
+    } while (0)
+
+static const uint8_t bench_sizes[][2] PROGMEM = {{1, 1}, {8, 8}, {16, 16}, {64, 32}, {128, 64}};
+static const uint8_t bench_alignments[] PROGMEM = {0, 3};
+
+static void bench_drawArea(void) {
+    uint8_t pattern[8];
+    dogmGraphic_setDitherPattern(pattern, 24);
+    for (uint8_t i = 0; i < sizeof(bench_sizes) / sizeof(bench_sizes[0]); i++) {
+        uint8_t width = pgm_read_byte(&bench_sizes[i][0]);
+        uint8_t height = pgm_read_byte(&bench_sizes[i][1]);
+
+        for (uint8_t j = 0; j < sizeof(bench_alignments); j++) {
+            uint8_t y = pgm_read_byte(&bench_alignments[j]);
+            if (y + height > DOGM_DISPLAY_HEIGHT) {
+                continue;
+            }
+
+            for (uint8_t type = DOGM_ADD; type <= DOGM_SET; type++) {
+                dogmGraphic_clearWholeDisplay();
+                bench_start();
+                dogmGraphic_drawArea(0, y, width, height, (dogmGraphic_drawType_t) type);
+                uint32_t cycles = bench_stop();
+                bench_reportSized(PSTR("drawArea"), (dogmGraphic_drawType_t) type, width, height, y, cycles);
+
+                // the same area with a dither pattern
+                dogmGraphic_clearWholeDisplay();
+                bench_start();
+                dogmGraphic_drawPatternArea(0, y, width, height, pattern, (dogmGraphic_drawType_t) type);
+                cycles = bench_stop();
+                bench_reportSized(PSTR("drawPatternArea"), (dogmGraphic_drawType_t) type, width, height, y, cycles);
+            }
+        }
+    }
+}
+
+static void bench_drawP(void) {
+    for (uint8_t j = 0; j < sizeof(bench_alignments); j++) {
+        uint8_t y = pgm_read_byte(&bench_alignments[j]);
+
+        for (uint8_t type = DOGM_ADD; type <= DOGM_SET; type++) {
+            dogmGraphic_clearWholeDisplay();
+            bench_start();
+            dogmGraphic_drawP(8, y, symbol_ok.width, symbol_ok.height, (dogmGraphic_drawType_t) type,
+                              symbol_ok.datapath);
+            uint32_t cycles = bench_stop();
+            bench_reportSized(PSTR("drawP"), (dogmGraphic_drawType_t) type, symbol_ok.width, symbol_ok.height, y,
+                              cycles);
+        }
+    }
+}
+
+/*! @brief sprite sheet in ram, 4 sprites of 16x16 pixels
+ */
+static uint8_t bench_sheet[2][64];
+
+/*! @brief run length encoded full screen frame, runs only
+ */
+#define BENCH_FRAME_PAGE DOGM_RLE_ONES | 1, DOGM_RLE_ZEROS | 63, DOGM_RLE_ZEROS | 59, DOGM_RLE_ONES | 1
+static const uint8_t bench_frame[] PROGMEM = {
+        DOGM_RLE_ONES | 63, DOGM_RLE_ONES | 63,
+        BENCH_FRAME_PAGE, BENCH_FRAME_PAGE, BENCH_FRAME_PAGE, BENCH_FRAME_PAGE, BENCH_FRAME_PAGE, BENCH_FRAME_PAGE,
+        DOGM_RLE_ONES | 63, DOGM_RLE_ONES | 63
+};
+
+/*! @brief the sprite sheet run length encoded as literals only, the worst case of the decoder
+ */
+static uint8_t bench_sheetRle[2][65];
+
+static void bench_blit(void) {
+    // a fixed irregular pattern, so the blits merge real data instead of zeros
+    for (uint8_t page = 0; page < 2; page++) {
+        for (uint8_t column = 0; column < 64; column++) {
+            bench_sheet[page][column] = (uint8_t) ((column * 37u) ^ (page * 0x5Au) ^ (column >> 2));
+        }
+    }
+
+    const dogmGraphic_bitmap_t sheet = {bench_sheet, 64, 16, DOGM_MEMORY_RAM, DOGM_BITMAP_RAW};
+    BENCH("blit", "ram_16x16_y0", 256, dogmGraphic_blit(8, 0, &sheet, 16, 0, 16, 16, DOGM_SET));
+    BENCH("blit", "ram_16x16_y3", 256, dogmGraphic_blit(8, 3, &sheet, 16, 0, 16, 16, DOGM_SET));
+    BENCH("blit", "ram_16x10_y3_sub", 160, dogmGraphic_blit(8, 3, &sheet, 16, 5, 16, 10, DOGM_SET));
+    BENCH("blit", "ram_64x16_y0", 1024, dogmGraphic_blit(8, 0, &sheet, 0, 0, 64, 16, DOGM_SET));
+    BENCH("blit", "ram_64x16_y3", 1024, dogmGraphic_blit(8, 3, &sheet, 0, 0, 64, 16, DOGM_SET));
+
+    for (uint8_t page = 0; page < 2; page++) {
+        bench_sheetRle[page][0] = DOGM_RLE_LITERAL | 63;
+        memcpy(&bench_sheetRle[page][1], bench_sheet[page], 64);
+    }
+    const dogmGraphic_bitmap_t literals = {bench_sheetRle, 64, 16, DOGM_MEMORY_RAM, DOGM_BITMAP_RLE};
+    const dogmGraphic_bitmap_t frame = {bench_frame, 128, 64, DOGM_MEMORY_PROGMEM, DOGM_BITMAP_RLE};
+    BENCH("blit", "rle_literal_64x16_y0", 1024, dogmGraphic_blit(8, 0, &literals, 0, 0, 64, 16, DOGM_SET));
+    BENCH("blit", "rle_literal_64x16_y3", 1024, dogmGraphic_blit(8, 3, &literals, 0, 0, 64, 16, DOGM_SET));
+    BENCH("blit", "rle_literal_16x16_y0_sub", 256, dogmGraphic_blit(8, 0, &literals, 40, 0, 16, 16, DOGM_SET));
+    BENCH("blit", "rle_frame_128x64", 8192, dogmGraphic_blit(0, 0, &frame, 0, 0, 128, 64, DOGM_SET));
+}
+
+/*! @brief trend chart with one line segment per column
+ */
+static void bench_trend(void) {
+    uint8_t y = 32;
+    uint8_t value = 7;
+    for (uint8_t x = 0; x < (DOGM_DISPLAY_WIDTH - 1); x++) {
+        value = (uint8_t) (value * 37 + 11);
+        uint8_t next = (uint8_t) ((y + (value & 0x0F) - 8) & (DOGM_DISPLAY_HEIGHT - 1));
+        dogmGraphic_drawLineXY(x, y, x + 1, next, DRAW_LINE_FILLED);
+        y = next;
+    }
+}
+
+static void bench_drawLine(void) {
+    BENCH("drawLineXY", "horizontal_100", 100, dogmGraphic_drawLineXY(10, 20, 109, 20, DRAW_LINE_FILLED));
+    BENCH("drawLineXY", "vertical_60", 60, dogmGraphic_drawLineXY(10, 2, 10, 61, DRAW_LINE_FILLED));
+    BENCH("drawLineXY", "diagonal_64", 64, dogmGraphic_drawLineXY(0, 0, 63, 63, DRAW_LINE_FILLED));
+    BENCH("drawLineXY", "shallow_120x20", 120, dogmGraphic_drawLineXY(0, 10, 119, 29, DRAW_LINE_FILLED));
+    BENCH("drawLineXY", "steep_20x60", 60, dogmGraphic_drawLineXY(10, 0, 29, 59, DRAW_LINE_FILLED));
+    BENCH("drawLineXY", "dotted_100", 100, dogmGraphic_drawLineXY(10, 20, 109, 20, DRAW_LINE_DOTTED));
+    BENCH("drawLineXY", "dashed_100", 100, dogmGraphic_drawLineXY(10, 20, 109, 20, DRAW_LINE_DASHED));
+    BENCH("drawLineXY", "trend_127", 0, bench_trend());
+    BENCH("drawLineStroke", "diagonal_64_w3", 64, dogmGraphic_drawLineStroke(0, 0, 63, 63, 3));
+    BENCH("drawLineStroke", "shallow_120x20_w5", 120, dogmGraphic_drawLineStroke(0, 10, 119, 29, 5));
+    BENCH("drawRectangleStroke", "128x64_w2", 0, dogmGraphic_drawRectangleStroke(0, 0, 128, 64, 2));
+}
+
+static void bench_drawCircle(void) {
+    BENCH("drawCircleOutline", "r5", 0, dogmGraphic_drawCircleOutline(64, 32, 5, 0));
+    BENCH("drawCircleOutline", "r15", 0, dogmGraphic_drawCircleOutline(64, 32, 15, 0));
+    BENCH("drawCircleOutline", "r30", 0, dogmGraphic_drawCircleOutline(64, 32, 30, 0));
+    BENCH("drawCircleOutline", "r5_filled", 0, dogmGraphic_drawCircleOutline(64, 32, 5, 1));
+    BENCH("drawCircleOutline", "r15_filled", 0, dogmGraphic_drawCircleOutline(64, 32, 15, 1));
+    BENCH("drawCircleOutline", "r30_filled", 0, dogmGraphic_drawCircleOutline(64, 32, 30, 1));
+    BENCH("drawEllipse", "50x20", 0, dogmGraphic_drawEllipse(64, 32, 50, 20, 0));
+    BENCH("drawEllipse", "50x20_filled", 0, dogmGraphic_drawEllipse(64, 32, 50, 20, 1));
+    BENCH("drawCircleStroke", "r30_w4", 0, dogmGraphic_drawCircleStroke(64, 32, 30, 4));
+    BENCH("drawEllipseStroke", "50x20_w3", 0, dogmGraphic_drawEllipseStroke(64, 32, 50, 20, 3));
+    BENCH("drawArc", "r30_270_w4", 0, dogmGraphic_drawArc(64, 32, 30, -45, 225, 4));
+    BENCH("drawPie", "r30_120", 0, dogmGraphic_drawPie(64, 32, 30, 30, 150));
+    BENCH("drawNeedle", "r28_w3", 0, dogmGraphic_drawNeedle(64, 32, 4, 28, 60, 3));
+    BENCH("drawRoundedRectangle", "60x20_r6", 0, dogmGraphic_drawRoundedRectangle(10, 10, 60, 20, 6, 1));
+    BENCH("drawTriangle", "60x40", 0, dogmGraphic_drawTriangle(30, 10, 90, 30, 40, 50, DOGM_ADD));
+}
+
+static void bench_drawFont(void) {
+    draw_font_setCursorLineEnd(DOGM_DISPLAY_WIDTH - 1);
+
+    draw_font_setFont(FONT_PROP_8);
+    draw_font_setCursorXY(0, 0);
+    uint16_t pixels = (uint16_t) draw_font_getCharWidth('A') * 8;
+    BENCH("font_char", "8px_y0", pixels, draw_font_char(DOGM_SET, 'A'));
+    draw_font_setCursorXY(0, 3);
+    BENCH("font_char", "8px_y3", pixels, draw_font_char(DOGM_SET, 'A'));
+
+    draw_font_setFont(FONT_PROP_16);
+    draw_font_setCursorXY(0, 0);
+    pixels = (uint16_t) draw_font_getCharWidth('A') * 16;
+    BENCH("font_char", "16px_y0", pixels, draw_font_char(DOGM_SET, 'A'));
+    draw_font_setCursorXY(0, 3);
+    BENCH("font_char", "16px_y3", pixels, draw_font_char(DOGM_SET, 'A'));
+
+    draw_font_setFont(FONT_PROP_8);
+    draw_font_setCursorXY(0, 0);
+    BENCH("font_stringP", "8px_alive", 0, draw_font_stringP(DOGM_SET, PSTR("alive.")));
+    draw_font_setCursorXY(0, 3);
+    BENCH("font_stringP", "8px_alive_y3", 0, draw_font_stringP(DOGM_SET, PSTR("alive.")));
+    draw_font_setCursorXY(0, 0);
+    BENCH("font_stringP", "8px_line", 0, draw_font_stringP(DOGM_SET, PSTR("The quick brown fox jumps")));
+
+    draw_font_setFont(FONT_PROP_16);
+    draw_font_setCursorXY(0, 0);
+    BENCH("font_stringP", "16px_alive", 0, draw_font_stringP(DOGM_SET, PSTR("alive.")));
+}
+
+static void bench_drawNumbers(void) {
+    draw_font_setFont(FONT_PROP_8);
+    draw_font_setCursorLineEnd(DOGM_DISPLAY_WIDTH - 1);
+
+    draw_font_setCursorXY(0, 0);
+    BENCH("font_numberInt16", "-12345_dec", 0, draw_font_numberInt16(DOGM_SET, -12345, 10, DRAW_ALIGNMENT_LEFT));
+    draw_font_setCursorXY(0, 0);
+    BENCH("font_numberUint16", "65535_dec", 0, draw_font_numberUint16(DOGM_SET, 65535, 10, DRAW_ALIGNMENT_LEFT));
+    draw_font_setCursorXY(0, 0);
+    BENCH("font_numberUint16", "ffff_hex", 0, draw_font_numberUint16(DOGM_SET, 0xFFFF, 16, DRAW_ALIGNMENT_LEFT));
+    draw_font_setCursorXY(0, 0);
+    BENCH("font_numberUint16Fixed", "123.45", 0,
+          draw_font_numberUint16Fixed(DOGM_SET, 12345, 2, 10, DRAW_ALIGNMENT_LEFT));
+    draw_font_setCursorXY(0, 0);
+    BENCH("font_numberInt32", "-1234567890_dec", 0,
+          draw_font_numberInt32(DOGM_SET, -1234567890L, 10, DRAW_ALIGNMENT_LEFT));
+    draw_font_setCursorXY(0, 0);
+    BENCH("font_numberUint32", "4294967295_dec", 0,
+          draw_font_numberUint32(DOGM_SET, 4294967295UL, 10, DRAW_ALIGNMENT_LEFT));
+    draw_font_setCursorXY(0, 0);
+    BENCH("font_numberUint16", "65535_right", 0, draw_font_numberUint16(DOGM_SET, 65535, 10, DRAW_ALIGNMENT_RIGHT));
+}
+
+#if DOGM_GRAY_PLANES
+/*! @brief measure one complete grayscale cycle
+ *
+ * @param param     name of the measurement in flash
+ * @param width     width of the gray columns
+ * @param height    height of the gray area
+ */
+static void bench_grayCycle(const char* param, uint8_t width, uint8_t height) {
+    dogmGraphic_clearWholeDisplay();
+    dogmGraphic_clearGray();
+    dogmGraphic_drawGrayArea(0, 0, width, height, 1);
+    dogmGraphic_grayStart();
+    bench_start();
+    for (uint8_t frame = 0; frame < DOGM_GRAY_FRAMES; frame++) {
+        dogmGraphic_grayTick();
+    }
+    uint32_t cycles = bench_stop();
+    dogmGraphic_grayStop();
+    bench_report(PSTR("grayTick"), param, cycles, (uint16_t) width * height);
+}
+
+static void bench_gray(void) {
+    bench_grayCycle(PSTR("cycle_128x64"), DOGM_DISPLAY_WIDTH, DOGM_DISPLAY_HEIGHT);
+    bench_grayCycle(PSTR("cycle_64x32"), DOGM_DISPLAY_WIDTH / 2, DOGM_DISPLAY_HEIGHT / 2);
+}
+#endif
+
+int main(void) {
+    dogmGraphic_init();
+
+    TIMSK1 = (1 << TOIE1);
+    sei();
+
+    // overhead of the measurement itself
+    bench_overhead = 0;
+    bench_start();
+    uint32_t overhead = bench_stop();
+    bench_overhead = overhead;
+
+    bench_printP(PSTR("name,param,cycles,pixels,cycles_per_pixel\n"));
+    bench_drawArea();
+    bench_drawLine();
+    bench_drawCircle();
+    bench_drawP();
+    bench_blit();
+    bench_drawFont();
+    bench_drawNumbers();
+#if DOGM_GRAY_PLANES
+    bench_gray();
+#endif
+
+    // simavr stops with interrupts disabled and the cpu sleeping
+    cli();
+    sleep_cpu();
+    return 0;
+}
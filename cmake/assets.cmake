@@ -0,0 +1,74 @@
+cmake_minimum_required(VERSION 2.8)
+##################################################################################
+#
+# Author: Maximilian Blase
+# Date: 17.10.2026
+#
+# This file compiles images into imageData_t definitions with the host tool
+# tools/dogmAsset.cpp.
+#
+# dogm_add_assets(<name> [RLE] [DITHER] [INVERT] [THRESHOLD <0-255>]
+#                 IMAGES <PBM or PGM files>...)
+#
+# The custom command writes <name>.c and <name>.h into the actual binary
+# directory. The source is returned in <name>_SOURCES and the directory of the
+# header in <name>_INCLUDE_DIR. The name of an image is its file name without
+# extension. All images of one call are converted in parallel.
+##################################################################################
+include(CMakeParseArguments)
+
+if (DOGM_HOST_BUILD)
+    add_subdirectory(${PROJECT_SOURCE_DIR}/tools ${CMAKE_BINARY_DIR}/tools)
+endif ()
+
+function(dogm_add_assets NAME)
+    cmake_parse_arguments(ASSETS "RLE;DITHER;INVERT" "THRESHOLD" "IMAGES" ${ARGN})
+
+    if (DOGM_HOST_BUILD)
+        set(ASSET_COMMAND dogm-asset)
+        set(ASSET_TARGET dogm-asset)
+    else ()
+        # the avr toolchain can not build the host tool, so it gets a build of its own
+        if (NOT TARGET dogm-asset-host)
+            include(ExternalProject)
+            ExternalProject_Add(dogm-asset-host
+                    SOURCE_DIR ${PROJECT_SOURCE_DIR}/tools
+                    BINARY_DIR ${CMAKE_BINARY_DIR}/tools
+                    INSTALL_COMMAND ""
+            )
+        endif ()
+        set(ASSET_COMMAND ${CMAKE_BINARY_DIR}/tools/dogm-asset)
+        set(ASSET_TARGET dogm-asset-host)
+    endif ()
+
+    set(ASSET_OPTIONS -I ${PROJECT_SOURCE_DIR}/lcd_src/drawing/drawingFigures.h)
+    if (ASSETS_RLE)
+        list(APPEND ASSET_OPTIONS --rle)
+    endif ()
+    if (ASSETS_DITHER)
+        list(APPEND ASSET_OPTIONS --dither)
+    endif ()
+    if (ASSETS_INVERT)
+        list(APPEND ASSET_OPTIONS --invert)
+    endif ()
+    if (DEFINED ASSETS_THRESHOLD)
+        list(APPEND ASSET_OPTIONS --threshold ${ASSETS_THRESHOLD})
+    endif ()
+
+    set(ASSET_IMAGES)
+    foreach (IMAGE ${ASSETS_IMAGES})
+        get_filename_component(IMAGE ${IMAGE} ABSOLUTE)
+        list(APPEND ASSET_IMAGES ${IMAGE})
+    endforeach ()
+
+    set(ASSET_OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/${NAME})
+    add_custom_command(
+            OUTPUT ${ASSET_OUTPUT}.c ${ASSET_OUTPUT}.h
+            COMMAND ${ASSET_COMMAND} ${ASSET_OPTIONS} -o ${ASSET_OUTPUT} ${ASSET_IMAGES}
+            DEPENDS ${ASSET_TARGET} ${ASSET_IMAGES}
+            COMMENT "Compiling assets ${NAME}"
+            VERBATIM
+    )
+    set(${NAME}_SOURCES ${ASSET_OUTPUT}.c PARENT_SCOPE)
+    set(${NAME}_INCLUDE_DIR ${CMAKE_CURRENT_BINARY_DIR} PARENT_SCOPE)
+endfunction(dogm_add_assets)
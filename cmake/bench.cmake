@@ -0,0 +1,132 @@
+##################################################################################
+#
+# Author: Maximilian Blase
+# Date: 17.10.2026
+#
+# This script runs the benchmark firmware under simavr and checks the cycles.
+#
+# Usage: cmake -DBENCH_SIMAVR=<simavr> -DBENCH_MCU=<mcu> -DBENCH_FREQUENCY=<hz>
+#              -DBENCH_ELF=<elf> -DBENCH_CSV=<output csv>
+#              -DBENCH_THRESHOLDS=<thresholds csv> [-DBENCH_UPDATE=ON]
+#              [-DBENCH_TOLERANCE=<percent>] [-DBENCH_GRAY_RATE=<hz>] -P bench.cmake
+#
+# Every line of the thresholds file is "name,param,max_cycles". A measurement
+# above its threshold fails the run, so does a measurement without a threshold.
+# With BENCH_UPDATE the thresholds are rewritten from the actual measurement
+# plus BENCH_TOLERANCE percent. The cycles of a grayscale cycle are also printed
+# as CPU load at BENCH_GRAY_RATE cycles per second.
+##################################################################################
+# rows without pixels end with an empty field
+cmake_policy(SET CMP0007 NEW)
+
+if (NOT BENCH_TOLERANCE)
+    set(BENCH_TOLERANCE 5)
+endif ()
+
+##################################################################################
+# run the firmware, it stops itself by sleeping with disabled interrupts
+execute_process(
+        COMMAND ${BENCH_SIMAVR} -m ${BENCH_MCU} -f ${BENCH_FREQUENCY} ${BENCH_ELF}
+        OUTPUT_VARIABLE bench_stdout
+        ERROR_VARIABLE bench_stderr
+        RESULT_VARIABLE bench_result
+        TIMEOUT 600
+)
+if (NOT bench_result EQUAL 0)
+    message(FATAL_ERROR "simavr failed: ${bench_result}\n${bench_stderr}")
+endif ()
+
+##################################################################################
+# collect the CSV lines of the console, simavr may add its own text around them
+string(REGEX MATCHALL "[A-Za-z][A-Za-z0-9_]*,[-A-Za-z0-9_.]+,[0-9]+,[0-9]+,[0-9.]*"
+        bench_rows "${bench_stdout}\n${bench_stderr}")
+list(LENGTH bench_rows bench_count)
+if (bench_count EQUAL 0)
+    message(FATAL_ERROR "No benchmark results in the simavr output:\n${bench_stdout}${bench_stderr}")
+endif ()
+
+set(bench_csv "name,param,cycles,pixels,cycles_per_pixel\n")
+foreach (row ${bench_rows})
+    set(bench_csv "${bench_csv}${row}\n")
+endforeach ()
+file(WRITE ${BENCH_CSV} "${bench_csv}")
+message(STATUS "${bench_count} results written to ${BENCH_CSV}")
+
+##################################################################################
+# CPU load of the grayscale mode, one grayTick result is one whole cycle
+if (NOT BENCH_GRAY_RATE)
+    set(BENCH_GRAY_RATE 50)
+endif ()
+foreach (row ${bench_rows})
+    if (row MATCHES "^grayTick,")
+        string(REPLACE "," ";" fields "${row}")
+        list(GET fields 1 param)
+        list(GET fields 2 cycles)
+        math(EXPR permille "${cycles} * ${BENCH_GRAY_RATE} * 10 / (${BENCH_FREQUENCY} / 100)")
+        math(EXPR percent "${permille} / 10")
+        math(EXPR tenth "${permille} % 10")
+        message(STATUS "grayTick ${param}: ${percent}.${tenth}% CPU load at a ${BENCH_GRAY_RATE}Hz cycle")
+    endif ()
+endforeach ()
+
+##################################################################################
+# write new thresholds
+if (BENCH_UPDATE)
+    set(thresholds "# name,param,max_cycles; written by the bench_update target, measurement + ${BENCH_TOLERANCE}%\n")
+    foreach (row ${bench_rows})
+        string(REPLACE "," ";" fields "${row}")
+        list(GET fields 0 name)
+        list(GET fields 1 param)
+        list(GET fields 2 cycles)
+        math(EXPR max "${cycles} + (${cycles} * ${BENCH_TOLERANCE} + 99) / 100")
+        set(thresholds "${thresholds}${name},${param},${max}\n")
+    endforeach ()
+    file(WRITE ${BENCH_THRESHOLDS} "${thresholds}")
+    message(STATUS "Thresholds written to ${BENCH_THRESHOLDS}")
+    return()
+endif ()
+
+##################################################################################
+# read thresholds
+if (EXISTS ${BENCH_THRESHOLDS})
+    file(STRINGS ${BENCH_THRESHOLDS} threshold_lines REGEX "^[^#]")
+endif ()
+foreach (line ${threshold_lines})
+    string(REPLACE "," ";" fields "${line}")
+    list(GET fields 0 name)
+    list(GET fields 1 param)
+    list(GET fields 2 max)
+    string(MAKE_C_IDENTIFIER "${name}__${param}" key)
+    set(threshold_${key} ${max})
+endforeach ()
+
+##################################################################################
+# compare
+set(bench_failed "")
+set(bench_new "")
+foreach (row ${bench_rows})
+    string(REPLACE "," ";" fields "${row}")
+    list(GET fields 0 name)
+    list(GET fields 1 param)
+    list(GET fields 2 cycles)
+    string(MAKE_C_IDENTIFIER "${name}__${param}" key)
+
+    if (NOT DEFINED threshold_${key})
+        set(bench_new "${bench_new}    ${name},${param}: ${cycles} cycles\n")
+    elseif (cycles GREATER threshold_${key})
+        set(bench_failed "${bench_failed}    ${name},${param}: ${cycles} cycles, threshold ${threshold_${key}}\n")
+    endif ()
+endforeach ()
+
+# a new or renamed measurement is never passed silently
+if (bench_failed OR bench_new)
+    set(bench_message "")
+    if (bench_failed)
+        set(bench_message "Thresholds exceeded:\n${bench_failed}")
+    endif ()
+    if (bench_new)
+        set(bench_message "${bench_message}Results without threshold, write them with the _update target:\n${bench_new}")
+    endif ()
+    message(FATAL_ERROR "${bench_message}")
+endif ()
+message(STATUS "All thresholds kept")
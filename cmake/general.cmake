@@ -24,6 +24,7 @@ include_directories(${PROJECT_SOURCE_DIR}/logging_src)
 
 ##################################################################################
 # add all needed sources and headers
+INCLUDE(cmake/assets.cmake)
 INCLUDE(cmake/include.cmake)
 
 ##################################################################################
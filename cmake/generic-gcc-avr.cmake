@@ -278,6 +278,82 @@ function(add_avr_executable EXECUTABLE_NAME)
 
 endfunction(add_avr_executable)
 
+##########################################################################
+# add_avr_bench
+# - IN_VAR: BENCH_NAME
+# - ARGN  : sources of the benchmark firmware, followed by the optional
+#           DEFINITIONS <compile definitions...> and THRESHOLDS <file>
+# Builds a benchmark firmware like add_avr_executable and runs it under
+# simavr. The firmware writes CSV lines to the simavr console, which are
+# stored in <BENCH_NAME>.csv of the build directory and compared with
+# the thresholds file, bench/thresholds.csv by default, by
+# cmake/bench.cmake.
+# - <BENCH_NAME>        run and fail, if a threshold is exceeded
+# - <BENCH_NAME>_update run and write new thresholds
+# Without simavr and its headers no target is created.
+##########################################################################
+function(add_avr_bench BENCH_NAME)
+    include(CMakeParseArguments)
+    cmake_parse_arguments(BENCH "" "THRESHOLDS" "DEFINITIONS" ${ARGN})
+    if(NOT BENCH_UNPARSED_ARGUMENTS)
+        message(FATAL_ERROR "No source files given for ${BENCH_NAME}.")
+    endif(NOT BENCH_UNPARSED_ARGUMENTS)
+    if(NOT BENCH_THRESHOLDS)
+        set(BENCH_THRESHOLDS ${PROJECT_SOURCE_DIR}/bench/thresholds.csv)
+    endif(NOT BENCH_THRESHOLDS)
+
+    find_program(AVR_SIMAVR simavr)
+    find_path(SIMAVR_INCLUDE_DIR simavr/avr/avr_mcu_section.h PATHS /usr/include /usr/local/include /opt/local/include)
+    if(NOT AVR_SIMAVR OR NOT SIMAVR_INCLUDE_DIR)
+        message(STATUS "simavr not found, no target ${BENCH_NAME}")
+        return()
+    endif(NOT AVR_SIMAVR OR NOT SIMAVR_INCLUDE_DIR)
+
+    # set file names
+    set(elf_file ${BENCH_NAME}${MCU_TYPE_FOR_FILENAME}.elf)
+    set(csv_file ${CMAKE_BINARY_DIR}/${BENCH_NAME}.csv)
+    string(REGEX REPLACE "[^0-9]" "" bench_frequency ${MCU_SPEED})
+
+    # elf file, the .mmcu section tells simavr the MCU and the console register
+    add_executable(${elf_file} EXCLUDE_FROM_ALL ${BENCH_UNPARSED_ARGUMENTS})
+    if(BENCH_DEFINITIONS)
+        target_compile_definitions(${elf_file} PRIVATE ${BENCH_DEFINITIONS})
+    endif(BENCH_DEFINITIONS)
+
+    set_target_properties(
+            ${elf_file}
+            PROPERTIES
+            COMPILE_FLAGS "-mmcu=${AVR_MCU} -I${SIMAVR_INCLUDE_DIR}"
+            LINK_FLAGS "-mmcu=${AVR_MCU} -Wl,--gc-sections -mrelax -Wl,--undefined=_mmcu,--section-start=.mmcu=0x910000"
+    )
+
+    set(bench_args
+            -DBENCH_SIMAVR=${AVR_SIMAVR}
+            -DBENCH_MCU=${AVR_MCU}
+            -DBENCH_FREQUENCY=${bench_frequency}
+            -DBENCH_ELF=${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/${elf_file}
+            -DBENCH_CSV=${csv_file}
+            -DBENCH_THRESHOLDS=${BENCH_THRESHOLDS}
+    )
+
+    # run and check
+    add_custom_target(
+            ${BENCH_NAME}
+            ${CMAKE_COMMAND} ${bench_args} -P ${PROJECT_SOURCE_DIR}/cmake/bench.cmake
+            DEPENDS ${elf_file}
+            COMMENT "Running ${elf_file} under simavr"
+    )
+
+    # run and write new thresholds
+    add_custom_target(
+            ${BENCH_NAME}_update
+            ${CMAKE_COMMAND} ${bench_args} -DBENCH_UPDATE=ON -P ${PROJECT_SOURCE_DIR}/cmake/bench.cmake
+            DEPENDS ${elf_file}
+            COMMENT "Running ${elf_file} under simavr, writing new thresholds"
+    )
+
+endfunction(add_avr_bench)
+
 ##########################################################################
 # add_avr_library
 # - IN_VAR: LIBRARY_NAME
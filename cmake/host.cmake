@@ -0,0 +1,70 @@
+cmake_minimum_required(VERSION 2.8)
+##################################################################################
+#
+# Author: Maximilian Blase
+# Date: 17.10.2026
+#
+# This file contains the native host build of the display library and its tests.
+#
+# No AVR toolchain is needed. The hardware is replaced by the host backend of the
+# HAL, which records every byte sent to the display.
+##################################################################################
+if (NOT CMAKE_BUILD_TYPE)
+    set(CMAKE_BUILD_TYPE Release)
+endif ()
+
+##################################################################################
+# host binaries belong to the build directory, not to the AVR ones in bin
+set(CMAKE_RUNTIME_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/bin")
+
+##################################################################################
+# compiler options, char and enum behave like on the AVR
+add_definitions("-DPLATFORM_HOST=1")
+add_definitions("-DF_CPU=${MCU_SPEED}")
+add_definitions("-fshort-enums")
+add_definitions("-Wall")
+add_definitions("-funsigned-char")
+add_definitions("-funsigned-bitfields")
+# room for the canvases of the tests
+add_definitions("-DDOGM_CANVAS_ARENA_BYTES=512")
+set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -std=c11")
+
+include_directories(${PROJECT_SOURCE_DIR}/logging_src)
+
+##################################################################################
+# sources: the whole lcd_src tree, the host platform and the logging without uart
+file(GLOB_RECURSE HOST_LCD_FILES ${PROJECT_SOURCE_DIR}/lcd_src/*.c)
+set(HOST_SYS_FILES
+        ${PROJECT_SOURCE_DIR}/sys_src/platform-host.c
+        ${PROJECT_SOURCE_DIR}/logging_src/logging.c
+        ${PROJECT_SOURCE_DIR}/logging_src/stream.c
+)
+
+##################################################################################
+# add_host_library
+# - IN_VAR: LIBRARY_NAME
+# - ARGN  : compile definitions of this variant, e.g. DOGM_USE_SHADOW_RAM=1
+# Builds the display library for the host. The definitions are public, so every
+# test linked to the library sees the same settings.
+##################################################################################
+function(add_host_library LIBRARY_NAME)
+    add_library(${LIBRARY_NAME} STATIC ${HOST_LCD_FILES} ${HOST_SYS_FILES})
+    if (ARGN)
+        target_compile_definitions(${LIBRARY_NAME} PUBLIC ${ARGN})
+    endif ()
+endfunction(add_host_library)
+
+add_host_library(dogm-host)
+add_host_library(dogm-host-shadow DOGM_USE_SHADOW_RAM=1)
+add_host_library(dogm-host-cache DOGM_SPRITE_CACHE_ENTRIES=4 DOGM_SPRITE_CACHE_BYTES=64)
+add_host_library(dogm-host-gray DOGM_GRAY_PLANES=2)
+add_host_library(dogm-host-shadow-gray DOGM_USE_SHADOW_RAM=1 DOGM_GRAY_PLANES=2)
+
+##################################################################################
+# asset compiler
+INCLUDE(${PROJECT_SOURCE_DIR}/cmake/assets.cmake)
+
+##################################################################################
+# tests
+enable_testing()
+add_subdirectory(test)
@@ -23,6 +23,23 @@ add_avr_executable(
         ${SRC_C_FILES} ${SRC_CXX_FILES} ${SRC_HEADERS}
 )
 
+##################################################################################
+# add benchmark firmware, all library sources without the main file
+set(BENCH_C_FILES ${SRC_C_FILES})
+list(REMOVE_ITEM BENCH_C_FILES ${PROJECT_SOURCE_DIR}/sys_src/main.c)
+add_avr_bench(
+        bench
+        ${PROJECT_SOURCE_DIR}/bench/benchMain.c ${BENCH_C_FILES}
+)
+
+# the same with the grayscale mode, it measures the cycles and the CPU load of grayTick
+add_avr_bench(
+        bench_gray
+        ${PROJECT_SOURCE_DIR}/bench/benchMain.c ${BENCH_C_FILES}
+        DEFINITIONS DOGM_GRAY_PLANES=2
+        THRESHOLDS ${PROJECT_SOURCE_DIR}/bench/thresholds_gray.csv
+)
+
 ##################################################################################
 # debug
 # message(FATAL_ERROR ${SRC_C_FILES})
\ No newline at end of file
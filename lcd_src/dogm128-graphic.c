@@ -30,15 +30,214 @@
  */
 
 #include "dogm128-graphic.h"
+#include <stddef.h>
+#include <string.h>
 #include <logging.h>
 
+dogmDisplay_t dogmGraphic_defaultDisplay;
+dogmDisplay_t *dogmGraphic_display = &dogmGraphic_defaultDisplay;
+
+/*! @brief vertical scroll offset of the bound display
+ *
+ * The logical row y of the drawing functions is stored in the ram row (y + offset) modulo 64. The start line of the
+ * display is set to the offset, so the logical row y is always shown in the display row y. startLinePending is set,
+ * when the start line command still has to be sent with the next flush.
+ */
+#define dogmGraphic_scrollOffset        (dogmGraphic_display->scrollOffset)
+#define dogmGraphic_startLinePending    (dogmGraphic_display->startLinePending)
+
+/*! @brief canvas, all drawing functions render into, NULL for the bound display
+ */
+static dogmCanvas_t *dogmGraphic_canvas = NULL;
+
+/*! @brief clip rectangle of the actual drawing target
+ */
+#define dogmGraphic_clip    (*((dogmGraphic_canvas != NULL) ? &dogmGraphic_canvas->clip : &dogmGraphic_display->clip))
+
+#if DOGM_GRAY_PLANES
+/*! @brief bit-plane, all drawing functions render into, DOGM_GRAY_PLANES - 1 for display_content
+ */
+static uint8_t dogmGraphic_plane = DOGM_GRAY_PLANES - 1;
+
+/*! @brief display of the grayscale mode, NULL if it is stopped
+ */
+static dogmDisplay_t *volatile dogmGraphic_grayDisplay = NULL;
+#endif
+
+#if DOGM_CANVAS_ARENA_BYTES
+/*! @brief static memory of all canvases
+ */
+static uint8_t dogmGraphic_arena[DOGM_CANVAS_ARENA_BYTES];
+static uint16_t dogmGraphic_arenaUsed = 0;
+#endif
+
+/*! @brief states of the asynchronous flush
+ *
+ * @param DOGM_FLUSH_IDLE       no flush running
+ * @param DOGM_FLUSH_ADDRESS    sending the page and column address commands
+ * @param DOGM_FLUSH_DATA       sending the ram content of the actual page
+ * @param DOGM_FLUSH_START_LINE sending the start line command after the last run of the actual display
+ * @param DOGM_FLUSH_STEPPING   stepped flush waiting for the next call of dogmGraphic_flushStep
+ */
+typedef enum {
+    DOGM_FLUSH_IDLE = 0, DOGM_FLUSH_ADDRESS, DOGM_FLUSH_DATA, DOGM_FLUSH_START_LINE, DOGM_FLUSH_STEPPING
+} dogmGraphic_flushState_t;
+
+/*! @brief actual state of the asynchronous or stepped flush
+ *
+ * This struct is only changed by dogmGraphic_flushRamAsyncStart and the SPI interrupt, or by dogmGraphic_flushStep.
+ * The flush sends the display and all following added displays until it reaches the first one again. The pages bits
+ * are the pages of the actual display, which are not completely sent yet, they are 0 for a display, which is only
+ * scrolled. The actual run of columns goes from column to
+ * runEnd. The index counts the address commands or the data columns, depending on the state. The column spans are
+ * copied, when the flush reaches the display, because the drawing functions may widen the spans of
+ * dogmGraphic_newColumns while the flush is running.
+ */
+static volatile struct {
+    dogmGraphic_flushState_t state;
+    dogmDisplay_t *first;
+    dogmDisplay_t *display;
+    uint8_t pages;
+    uint8_t page;
+    uint8_t column;
+    uint8_t runEnd;
+    uint8_t index;
+    uint8_t startLine;
+    newColumns_t columns[DOGM_DISPLAY_PAGES];
+} dogmGraphic_flushCursor;
+
+/*! @brief no start line command with the flush */
+#define DOGM_FLUSH_NO_START_LINE    0xFF
+
+/*! @brief number of address commands in front of every run */
+#define DOGM_FLUSH_ADDRESS_BYTES    3
+
+#if DOGM_USE_SHADOW_RAM
+/*! @brief number of equal bytes inside a run
+ *
+ * Every new run costs three address commands, so up to this number of unchanged bytes are sent again instead of
+ * starting a new run.
+ */
+#define DOGM_SHADOW_RAM_GAP     3
+#endif
+
+static uint8_t dogmGraphic_nextRun(dogmDisplay_t *display, uint8_t page, uint8_t *column, uint8_t end);
+
+static void dogmGraphic_sendColumns(dogmDisplay_t *display, uint8_t page, uint8_t start, uint8_t end);
+
+static uint8_t dogmGraphic_flushBegin(void);
+
+static uint8_t dogmGraphic_flushTake(dogmDisplay_t *display);
+
+static uint8_t dogmGraphic_flushNextDisplay(void);
+
+static void dogmGraphic_sendStartLine(dogmDisplay_t *display, uint8_t startLine);
+
+static void dogmGraphic_mergeColumns(newColumns_t *columns, uint8_t *pages, uint8_t page, uint8_t start, uint8_t end);
+
+static void dogmGraphic_drawAreaRows(uint8_t start_x, uint8_t row, uint8_t deltaWidth, uint8_t deltaHeight,
+                                     dogmGraphic_drawType_t type);
+
+static void dogmGraphic_fillClipped(int16_t x0, int16_t y0, int16_t x1, int16_t y1, dogmGraphic_drawType_t type);
+
+static void dogmGraphic_strokeLine(int16_t start_x, int16_t start_y, int16_t end_x, int16_t end_y, uint8_t width);
+
+static uint8_t dogmGraphic_clipArea(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1);
+
+static void dogmGraphic_patternRows(uint8_t start_x, uint8_t row, uint8_t deltaWidth, uint8_t deltaHeight,
+                                    const uint8_t *pattern, dogmGraphic_drawType_t type);
+
+static void dogmGraphic_fillRows(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                                 dogmGraphic_drawType_t type);
+
+static void dogmGraphic_polygonBegin(uint8_t first, uint8_t last, int8_t *top, int8_t *bottom);
+
+static void dogmGraphic_polygonSpans(uint8_t first, uint8_t last, const int8_t *top, const int8_t *bottom,
+                                     dogmGraphic_drawType_t type);
+
+static void dogmGraphic_blitRows(const dogmGraphic_bitmap_t *source, uint8_t column, int16_t origin, uint8_t x0,
+                                 uint8_t x1, uint8_t firstRow, uint8_t lastRow, dogmGraphic_drawType_t type);
+
+static void dogmGraphic_blitRowsRle(const dogmGraphic_bitmap_t *source, uint8_t column, int16_t origin, uint8_t x0,
+                                    uint8_t x1, uint8_t firstRow, uint8_t lastRow, dogmGraphic_drawType_t type);
+
+#if DOGM_SPRITE_CACHE_ENTRIES
+static const uint8_t *dogmGraphic_cacheGet(const dogmGraphic_bitmap_t *source, uint8_t shift);
+#endif
+
+static uint8_t dogmGraphic_flushSeek(void);
+
+static void dogmGraphic_asyncFlushNext(void);
+
 inline void dogmGraphic_setNewContent(uint8_t page) {
-    dogmGraphic_newContent.value |= (1 << page);
+    dogmGraphic_setNewContentColumns(page, 0, DOGM_DISPLAY_WIDTH - 1);
+}
+
+void dogmGraphic_setNewContentColumns(uint8_t page, uint8_t start, uint8_t end) {
+    if ((page >= DOGM_DISPLAY_PAGES) || (start >= DOGM_DISPLAY_WIDTH) || (end < start)) {
+        return;
+    }
+    if (end >= DOGM_DISPLAY_WIDTH) {
+        end = DOGM_DISPLAY_WIDTH - 1;
+    }
+    dogmGraphic_mergeColumns(dogmGraphic_newColumns, &dogmGraphic_newContent.value, page, start, end);
+}
+
+/*! @brief widen the column span of a page
+ *
+ * @param columns   spans of all pages
+ * @param pages     bits of the pages with a valid span
+ * @param page      vertical page
+ * @param start     first column
+ * @param end       last column, inside of the display
+ *
+ * The interrupts of the asynchronous flush and of the grayscale mode take the spans and clear the page bits, also of a
+ * display the main loop is drawing on. So the test and the widening must not be split by an interrupt.
+ */
+static void dogmGraphic_mergeColumns(newColumns_t *columns, uint8_t *pages, uint8_t page, uint8_t start, uint8_t end) {
+    uint8_t pageMask = (uint8_t) (1 << page);
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if (*pages & pageMask) {
+            if (start < columns[page].start) {
+                columns[page].start = start;
+            }
+            if (end > columns[page].end) {
+                columns[page].end = end;
+            }
+        }
+        else {
+            columns[page].start = start;
+            columns[page].end = end;
+            *pages |= pageMask;
+        }
+    }
 }
 
 void dogmGraphic_init(void) {
+    if (dogmGraphic_display->pins.port == NULL) {
+        // the default display keeps the pins of dogm128
+        dogmGraphic_display->pins = *dogm_pins;
+        dogm_pins = &dogmGraphic_display->pins;
+    }
+
+#if DOGM_USE_SHADOW_RAM
+    // the display ram is unknown after a reset
+    dogmGraphic_display->shadowValid = 0;
+#endif
+
+    // dogm_init starts with line 0
+    dogmGraphic_scrollOffset = 0;
+    dogmGraphic_startLinePending = 0;
+    dogmGraphic_resetClip();
+
     // first complete clean
     dogmGraphic_clearWholeDisplay();
+#if DOGM_GRAY_PLANES
+    memset(dogmGraphic_display->gray, 0x00, sizeof(dogmGraphic_display->gray));
+    dogmGraphic_display->grayPages = 0;
+    dogmGraphic_display->grayFrame = 0;
+    dogmGraphic_display->grayShown = DOGM_GRAY_PLANES - 1;
+#endif
 
     dogmGraphic_writePointer.width = 2;
     dogmGraphic_writePointer.height.page = 7;
@@ -46,32 +245,530 @@ void dogmGraphic_init(void) {
     return;
 }
 
-void dogmGraphic_writeRamPage(uint8_t page) {
-    DOGM_GOTO_ADDRESS(page, 0);
-    for (uint8_t i = 0; i < DOGM_DISPLAY_WIDTH; i++) {
-        dogm_data(display_content[page][i]);
+void dogmGraphic_bind(dogmDisplay_t *display) {
+    dogmGraphic_display = display;
+    if (display->pins.port != NULL) {
+        dogm_pins = &display->pins;
+    }
+}
+
+void dogmGraphic_addDisplay(dogmDisplay_t *display, const dogm_pins_t *pins) {
+    const dogm_pins_t *actualPins = dogm_pins;
+
+    display->pins = *pins;
+    dogm_pins = &display->pins;
+    DOGM_SET_DDR();
+    DOGM_UNSELECT();
+    dogm_pins = actualPins;
+
+    // the default display is the start of the ring
+    if (dogmGraphic_defaultDisplay.next == NULL) {
+        dogmGraphic_defaultDisplay.next = &dogmGraphic_defaultDisplay;
+    }
+    display->next = dogmGraphic_defaultDisplay.next;
+    dogmGraphic_defaultDisplay.next = display;
+}
+
+void dogmGraphic_removeDisplay(dogmDisplay_t *display) {
+    if ((display == &dogmGraphic_defaultDisplay) || (display->next == NULL)) {
+        return;
+    }
+
+    dogmDisplay_t *previous = &dogmGraphic_defaultDisplay;
+    while (previous->next != display) {
+        previous = previous->next;
+    }
+    previous->next = display->next;
+    display->next = NULL;
+
+    if (dogmGraphic_display == display) {
+        dogmGraphic_bind(&dogmGraphic_defaultDisplay);
     }
 }
 
+void dogmGraphic_writeRamPage(uint8_t page) {
+    dogmGraphic_writeRamColumns(page, 0, DOGM_DISPLAY_WIDTH - 1);
+}
+
+void dogmGraphic_writeRamColumns(uint8_t page, uint8_t start, uint8_t end) {
+    dogmGraphic_sendColumns(dogmGraphic_display, page, start, end);
+}
+
+/*! @brief send columns of a display
+ *
+ * @param display   display of the ram copy, its pins have to be actual
+ * @param page      vertical page
+ * @param start     first column
+ * @param end       last column
+ */
+static void dogmGraphic_sendColumns(dogmDisplay_t *display, uint8_t page, uint8_t start, uint8_t end) {
+    const uint8_t address[] = {
+            DOGM_PAGE_ADDR_CMD(page),
+            DOGM_COLUMN_ADDR_CMD_HIGH(start),
+            DOGM_COLUMN_ADDR_CMD_LOW(start)
+    };
+
+    // one transfer per page, chip select stays active for address and data
+    dogm_beginTransfer();
+    dogm_cmdBurst(address, sizeof(address));
+#if DOGM_USE_SHADOW_RAM
+    dogm_dataBurstCopy(&display->content[page][start], &display->shadow[page][start], (uint8_t) (end - start + 1));
+#else
+    dogm_dataBurst(&display->content[page][start], (uint8_t) (end - start + 1));
+#endif
+    dogm_endTransfer();
+}
+
 void dogmGraphic_flushRam(void* unused) {
+#if DOGM_GRAY_PLANES
+    // the grayscale frames send all changes
+    if (dogmGraphic_grayDisplay != NULL) {
+        return;
+    }
+#endif
+    // never share the bus with a running asynchronous flush, also not with its last start line byte on the wire; a
+    // stepped one is completed first
+    while ((dogmGraphic_flushCursor.state != DOGM_FLUSH_IDLE) &&
+           (dogmGraphic_flushCursor.state != DOGM_FLUSH_STEPPING)) {
+        DOGM_SPI_INT_WAIT();
+    }
+    if (dogmGraphic_flushCursor.state == DOGM_FLUSH_STEPPING) {
+        dogmGraphic_flushStep(UINT16_MAX);
+    }
+
+    dogmDisplay_t *display = dogmGraphic_display;
     uint8_t pageMask = 0x01;
     for (uint8_t i = 0; i < 8; i++) {
-        if (pageMask & dogmGraphic_newContent.value) {
-            dogmGraphic_writeRamPage(i);
+        if (pageMask & display->newContent.value) {
+            uint8_t column = display->newColumns[i].start;
+            uint8_t end = display->newColumns[i].end;
+
+            while (column <= end) {
+                uint8_t runEnd = dogmGraphic_nextRun(display, i, &column, end);
+                if (column > runEnd) {
+                    break;
+                }
+                dogmGraphic_sendColumns(display, i, column, runEnd);
+                column = runEnd + 1;
+            }
         }
         pageMask <<= 1;
     }
 
     //reset struct
-    dogmGraphic_newContent.value = 0;
+    display->newContent.value = 0;
+
+    // the new rows are in the display ram already, when they are shown
+    if (display->startLinePending) {
+        display->startLinePending = 0;
+        dogmGraphic_sendStartLine(display, display->scrollOffset);
+    }
+}
+
+/*! @brief send the start line command
+ *
+ * @param display       display to scroll
+ * @param startLine     first ram line shown in the top row
+ */
+static void dogmGraphic_sendStartLine(dogmDisplay_t *display, uint8_t startLine) {
+    const uint8_t cmd = DOGM_START_LINE | (startLine & 0x3F);
+    const dogm_pins_t *pins = dogm_pins;
+
+    dogm_pins = &display->pins;
+    dogm_beginTransfer();
+    dogm_cmdBurst(&cmd, 1);
+    dogm_endTransfer();
+    dogm_pins = pins;
+}
+
+/*! @brief find next run of columns to send
+ *
+ * @param display   display of the ram copy
+ * @param page      vertical page
+ * @param column    first column to search; returns first column of the run
+ * @param end       last changed column of the page
+ *
+ * @return          last column of the run
+ *
+ * This internal function returns the next run of columns inside the changed span, which has to be sent to the display.
+ * Without shadow ram, this is the rest of the span. With shadow ram, all bytes equal to the last sent ones are skipped
+ * and the run ends in front of the next larger gap of equal bytes. A page with unknown content is sent completely.
+ * There is no run left, if the returned column is behind the returned end.
+ */
+static uint8_t dogmGraphic_nextRun(dogmDisplay_t *display, uint8_t page, uint8_t *column, uint8_t end) {
+#if DOGM_USE_SHADOW_RAM
+    uint8_t pageMask = (uint8_t) (1 << page);
+    if (!(display->shadowValid & pageMask)) {
+        display->shadowValid |= pageMask;
+        *column = 0;
+        return DOGM_DISPLAY_WIDTH - 1;
+    }
+
+    const uint8_t *content = display->content[page];
+    const uint8_t *shadow = display->shadow[page];
+    uint8_t col = *column;
+
+    // skip unchanged bytes
+    while ((col <= end) && (content[col] == shadow[col])) {
+        col++;
+    }
+    *column = col;
+    if (col > end) {
+        return end;
+    }
+
+    uint8_t last = col;
+    uint8_t gap = 0;
+    for (col++; col <= end; col++) {
+        if (content[col] != shadow[col]) {
+            last = col;
+            gap = 0;
+        }
+        else if (++gap > DOGM_SHADOW_RAM_GAP) {
+            break;
+        }
+    }
+    return last;
+#else
+    (void) display;
+    (void) page;
+    (void) column;
+    return end;
+#endif
+}
+
+uint8_t dogmGraphic_flushRamAsyncStart(void) {
+    if (!dogmGraphic_flushRamAsyncDone()) {
+        return 0;
+    }
+#if DOGM_GRAY_PLANES
+    if (dogmGraphic_grayDisplay != NULL) {
+        return 1;
+    }
+#endif
+    if (!dogmGraphic_flushBegin()) {
+        // nothing changed at all
+        return 1;
+    }
+    dogmGraphic_flushCursor.index = 0;
+    dogmGraphic_flushCursor.state = dogmGraphic_flushCursor.pages ? DOGM_FLUSH_ADDRESS : DOGM_FLUSH_START_LINE;
+
+    const dogm_pins_t *pins = dogm_pins;
+    dogm_pins = &dogmGraphic_flushCursor.display->pins;
+    DOGM_INIT_SPI();
+    DOGM_SPI_CLEAR_FLAG();
+    DOGM_SELECT();
+    dogm_pins = pins;
+
+    // the first byte starts the chain, every transfer complete interrupt sends the next one
+    dogmGraphic_asyncFlushNext();
+    DOGM_SPI_INT_ENABLE();
+    return 1;
+}
+
+uint8_t dogmGraphic_flushRamAsyncPending(void) {
+    uint8_t pages = dogmGraphic_flushCursor.pages;
+    uint8_t count = 0;
+    while (pages) {
+        count += pages & 0x01;
+        pages >>= 1;
+    }
+    return count;
+}
+
+inline uint8_t dogmGraphic_flushRamAsyncDone(void) {
+    return (dogmGraphic_flushCursor.state == DOGM_FLUSH_IDLE) ? 1 : 0;
+}
+
+uint8_t dogmGraphic_flushStep(uint16_t budgetBytes) {
+#if DOGM_GRAY_PLANES
+    if ((dogmGraphic_grayDisplay != NULL) && (dogmGraphic_flushCursor.state == DOGM_FLUSH_IDLE)) {
+        return 1;
+    }
+#endif
+    if (dogmGraphic_flushCursor.state == DOGM_FLUSH_IDLE) {
+        if (!dogmGraphic_flushBegin()) {
+            return 1;
+        }
+        dogmGraphic_flushCursor.state = DOGM_FLUSH_STEPPING;
+    }
+    else if (dogmGraphic_flushCursor.state != DOGM_FLUSH_STEPPING) {
+        // asynchronous flush running
+        return 0;
+    }
+
+    // the bound display may differ from the one of the flush
+    const dogm_pins_t *pins = dogm_pins;
+    dogm_pins = &dogmGraphic_flushCursor.display->pins;
+
+    uint8_t done = 0;
+    for (;;) {
+        // a display, which is only scrolled, has no run
+        if (dogmGraphic_flushCursor.pages) {
+            uint8_t column = dogmGraphic_flushCursor.column;
+            uint8_t count = dogmGraphic_flushCursor.runEnd - column + 1;
+
+            // every call sends at least one data byte, so the flush always makes progress
+            if (budgetBytes <= DOGM_FLUSH_ADDRESS_BYTES) {
+                count = 1;
+                budgetBytes = 0;
+            }
+            else {
+                budgetBytes -= DOGM_FLUSH_ADDRESS_BYTES;
+                if (count > budgetBytes) {
+                    count = (uint8_t) budgetBytes;
+                }
+                budgetBytes -= count;
+            }
+
+            dogmGraphic_sendColumns(dogmGraphic_flushCursor.display, dogmGraphic_flushCursor.page, column,
+                                    column + count - 1);
+            dogmGraphic_flushCursor.column = column + count;
+
+            if (dogmGraphic_flushCursor.column <= dogmGraphic_flushCursor.runEnd) {
+                // budget exhausted inside the run, resume here with a new address
+                break;
+            }
+        }
+        if (!dogmGraphic_flushSeek()) {
+            // the new rows are in the display ram already, when they are shown
+            if (dogmGraphic_flushCursor.startLine != DOGM_FLUSH_NO_START_LINE) {
+                dogmGraphic_sendStartLine(dogmGraphic_flushCursor.display, dogmGraphic_flushCursor.startLine);
+                dogmGraphic_flushCursor.startLine = DOGM_FLUSH_NO_START_LINE;
+            }
+            if (!dogmGraphic_flushNextDisplay()) {
+                dogmGraphic_flushCursor.state = DOGM_FLUSH_IDLE;
+                done = 1;
+                break;
+            }
+            dogm_pins = &dogmGraphic_flushCursor.display->pins;
+        }
+        if (budgetBytes <= DOGM_FLUSH_ADDRESS_BYTES) {
+            break;
+        }
+    }
+
+    dogm_pins = pins;
+    return done;
+}
+
+/*! @brief start a new asynchronous or stepped flush
+ *
+ * @return  1=run or start line to send found; 0=nothing to send
+ *
+ * This internal function starts the flush with the bound display and continues with the following added displays,
+ * until one of them has a run or a start line to send.
+ */
+static uint8_t dogmGraphic_flushBegin(void) {
+    dogmGraphic_flushCursor.first = dogmGraphic_display;
+    dogmGraphic_flushCursor.display = dogmGraphic_display;
+    if (dogmGraphic_flushTake(dogmGraphic_display)) {
+        return 1;
+    }
+    return dogmGraphic_flushNextDisplay();
+}
+
+/*! @brief take the changed pages of a display for the flush
+ *
+ * @param display   next display of the flush
+ *
+ * @return  1=run or start line to send found; 0=nothing to send
+ *
+ * This internal function copies the changed pages and column spans to the flush cursor and resets the newContent
+ * bits, so every change from now on belongs to the next flush. The cursor is set to the first run. A pending start
+ * line is taken too, it is sent after the last run. The display may be drawn by the main loop, while the interrupt of
+ * the asynchronous flush takes it, so the copy is atomic.
+ */
+static uint8_t dogmGraphic_flushTake(dogmDisplay_t *display) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        // a scroll belongs to the flush, which sends its new rows
+        dogmGraphic_flushCursor.startLine = DOGM_FLUSH_NO_START_LINE;
+        if (display->startLinePending) {
+            display->startLinePending = 0;
+            dogmGraphic_flushCursor.startLine = display->scrollOffset;
+        }
+
+        dogmGraphic_flushCursor.pages = display->newContent.value;
+        for (uint8_t i = 0; i < DOGM_DISPLAY_PAGES; i++) {
+            dogmGraphic_flushCursor.columns[i] = display->newColumns[i];
+        }
+        display->newContent.value = 0;
+    }
+
+    dogmGraphic_flushCursor.page = 0;
+    dogmGraphic_flushCursor.column = 0;
+    if (dogmGraphic_flushSeek()) {
+        return 1;
+    }
+    return (dogmGraphic_flushCursor.startLine != DOGM_FLUSH_NO_START_LINE) ? 1 : 0;
+}
+
+/*! @brief complete the actual display of the flush and take the next one
+ *
+ * @return  1=next display with a run or a start line found; 0=flush complete
+ *
+ * This internal function takes the following displays round the ring, until one has a run or a start line to send or
+ * the first display of the flush is reached again. The start line of the completed display has to be sent and its
+ * chip select has to be released already.
+ */
+static uint8_t dogmGraphic_flushNextDisplay(void) {
+    dogmDisplay_t *display = dogmGraphic_flushCursor.display;
+    for (;;) {
+        display = display->next;
+        if ((display == NULL) || (display == dogmGraphic_flushCursor.first)) {
+            return 0;
+        }
+        dogmGraphic_flushCursor.display = display;
+        if (dogmGraphic_flushTake(display)) {
+            return 1;
+        }
+    }
+}
+
+/*! @brief find next run of the asynchronous or stepped flush
+ *
+ * @return  1=next run found; 0=display complete
+ *
+ * This internal function searches the next run starting at the actual page and column of the flush cursor. Every
+ * page without a run left is removed from the pages bits.
+ */
+static uint8_t dogmGraphic_flushSeek(void) {
+    uint8_t pages = dogmGraphic_flushCursor.pages;
+    uint8_t page = dogmGraphic_flushCursor.page;
+    uint8_t column = dogmGraphic_flushCursor.column;
+
+    while (pages) {
+        uint8_t pageMask = (uint8_t) (1 << page);
+        if (pages & pageMask) {
+            uint8_t end = dogmGraphic_flushCursor.columns[page].end;
+            if (column < dogmGraphic_flushCursor.columns[page].start) {
+                column = dogmGraphic_flushCursor.columns[page].start;
+            }
+
+            uint8_t runEnd = dogmGraphic_nextRun(dogmGraphic_flushCursor.display, page, &column, end);
+            if (column <= runEnd) {
+                dogmGraphic_flushCursor.pages = pages;
+                dogmGraphic_flushCursor.page = page;
+                dogmGraphic_flushCursor.column = column;
+                dogmGraphic_flushCursor.runEnd = runEnd;
+                return 1;
+            }
+
+            // page complete
+            pages &= (uint8_t) ~pageMask;
+        }
+        page++;
+        column = 0;
+    }
+
+    dogmGraphic_flushCursor.pages = 0;
+    return 0;
+}
+
+/*! @brief send next byte of the asynchronous flush
+ *
+ * This internal function puts the next address command or data byte of the running flush into the SPI data register.
+ * The A0 line is only changed between two bytes, so it is always stable while a byte is on the wire. After the last run
+ * of a display, its pending start line command is sent the same way, so the interrupt never waits for the SPI. After
+ * the last byte of a display, the chip select is released and the next display is selected. After the last display, the
+ * interrupt is disabled again. The pins of the flushed display are only used inside, so the main loop may bind another
+ * display meanwhile.
+ */
+static void dogmGraphic_asyncFlushNext(void) {
+    const dogm_pins_t *pins = dogm_pins;
+    dogmDisplay_t *display = dogmGraphic_flushCursor.display;
+    uint8_t index = dogmGraphic_flushCursor.index;
+
+    dogm_pins = &display->pins;
+    for (;;) {
+        if (dogmGraphic_flushCursor.state == DOGM_FLUSH_ADDRESS) {
+            switch (index) {
+                case 0:
+                    DOGM_COMMAND();
+                    DOGM_SPI_WRITE(DOGM_PAGE_ADDR_CMD(dogmGraphic_flushCursor.page));
+                    break;
+                case 1:
+                    DOGM_SPI_WRITE(DOGM_COLUMN_ADDR_CMD_HIGH(dogmGraphic_flushCursor.column));
+                    break;
+                case 2:
+                    DOGM_SPI_WRITE(DOGM_COLUMN_ADDR_CMD_LOW(dogmGraphic_flushCursor.column));
+                    break;
+                default:
+                    dogmGraphic_flushCursor.state = DOGM_FLUSH_DATA;
+                    index = dogmGraphic_flushCursor.column;
+                    DOGM_DATA();
+                    continue;
+            }
+            index++;
+            break;
+        }
+
+        if (dogmGraphic_flushCursor.state == DOGM_FLUSH_DATA) {
+            if (index <= dogmGraphic_flushCursor.runEnd) {
+                uint8_t data = display->content[dogmGraphic_flushCursor.page][index];
+#if DOGM_USE_SHADOW_RAM
+                display->shadow[dogmGraphic_flushCursor.page][index] = data;
+#endif
+                DOGM_SPI_WRITE(data);
+                index++;
+                break;
+            }
+
+            // run complete
+            dogmGraphic_flushCursor.column = index;
+            index = 0;
+            if (dogmGraphic_flushSeek()) {
+                dogmGraphic_flushCursor.state = DOGM_FLUSH_ADDRESS;
+                continue;
+            }
+            dogmGraphic_flushCursor.state = DOGM_FLUSH_START_LINE;
+        }
+
+        // the new rows are in the display ram already, when they are shown
+        if (dogmGraphic_flushCursor.startLine != DOGM_FLUSH_NO_START_LINE) {
+            DOGM_COMMAND();
+            DOGM_SPI_WRITE(DOGM_START_LINE | (dogmGraphic_flushCursor.startLine & 0x3F));
+            dogmGraphic_flushCursor.startLine = DOGM_FLUSH_NO_START_LINE;
+            break;
+        }
+
+        // display complete
+        DOGM_UNSELECT();
+        if (!dogmGraphic_flushNextDisplay()) {
+            DOGM_SPI_INT_DISABLE();
+            dogmGraphic_flushCursor.state = DOGM_FLUSH_IDLE;
+            break;
+        }
+        display = dogmGraphic_flushCursor.display;
+        dogm_pins = &display->pins;
+        DOGM_SELECT();
+        index = 0;
+        dogmGraphic_flushCursor.state = dogmGraphic_flushCursor.pages ? DOGM_FLUSH_ADDRESS : DOGM_FLUSH_START_LINE;
+    }
+
+    dogmGraphic_flushCursor.index = index;
+    dogm_pins = pins;
+}
+
+PLATFORM_ISR(DOGM_SPI_ISR) {
+    dogmGraphic_asyncFlushNext();
+}
+
+/*! @brief set write pointer to a ram row
+ *
+ * @param width     horizontal pos
+ * @param row       row in the ram copy, the scroll offset is already added
+ */
+static inline void dogmGraphic_setWritePointerRow(uint8_t width, uint8_t row) {
+    dogmGraphic_writePointer.width = width;
+
+    dogmGraphic_writePointer.height.page = row >> 3; //divide by 8
+    dogmGraphic_writePointer.height.bit = row & 0x7;
 }
 
 void dogmGraphic_setWritePointer(uint8_t width, uint8_t height) {
     if ((height < DOGM_DISPLAY_HEIGHT) && (width < DOGM_DISPLAY_WIDTH)) {
-        dogmGraphic_writePointer.width = width;
-
-        dogmGraphic_writePointer.height.page = height >> 3; //divide by 8
-        dogmGraphic_writePointer.height.bit = height & 0x7;
+        dogmGraphic_setWritePointerRow(width, (uint8_t) ((height + dogmGraphic_scrollOffset) & (DOGM_DISPLAY_HEIGHT - 1)));
     }
     else {
         logging_printString_P(LOG_WARNING, PSTR("Set write Pointer not possible; Out of range parameter"));
@@ -96,8 +793,65 @@ void dogmGraphic_clearWholeDisplay(void) {
         for (uint8_t col = 0; col < DOGM_DISPLAY_WIDTH; col++) {
             display_content[page][col] = 0x00;
         }
+        dogmGraphic_setNewContent(page);
+    }
+}
+
+void dogmGraphic_scroll(int8_t lines) {
+    if ((lines >= DOGM_DISPLAY_HEIGHT) || (lines <= -DOGM_DISPLAY_HEIGHT)) {
+        // nothing of the old content is visible anymore
+        dogmGraphic_clearWholeDisplay();
+        return;
+    }
+    if (!lines) {
+        return;
+    }
+
+    // the new offset may only be taken by a flush together with the cleared rows
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        dogmGraphic_scrollOffset = (uint8_t) ((dogmGraphic_scrollOffset + lines) & (DOGM_DISPLAY_HEIGHT - 1));
+        dogmGraphic_startLinePending = 0;
+    }
+
+    // the exposed rows still hold the rows scrolled out at the other side, also while a canvas is drawn
+    dogmCanvas_t *canvas = dogmGraphic_canvas;
+    dogmGraphic_canvas = NULL;
+    uint8_t start = (lines > 0) ? (uint8_t) (DOGM_DISPLAY_HEIGHT - lines) : 0;
+    uint8_t count = (lines > 0) ? (uint8_t) lines : (uint8_t) -lines;
+#if DOGM_GRAY_PLANES
+    // the same rows of every bit-plane
+    uint8_t plane = dogmGraphic_plane;
+    for (dogmGraphic_plane = 0; dogmGraphic_plane < DOGM_GRAY_PLANES; dogmGraphic_plane++) {
+        dogmGraphic_fillRows(0, start, DOGM_DISPLAY_WIDTH, count, DOGM_CLEAR);
     }
-    dogmGraphic_newContent.value = 0xff;
+    dogmGraphic_plane = plane;
+#else
+    dogmGraphic_fillRows(0, start, DOGM_DISPLAY_WIDTH, count, DOGM_CLEAR);
+#endif
+    dogmGraphic_canvas = canvas;
+    dogmGraphic_startLinePending = 1;
+}
+
+inline uint8_t dogmGraphic_getScrollOffset(void) {
+    return dogmGraphic_scrollOffset;
+}
+
+void dogmGraphic_setClip(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+    uint8_t width = (dogmGraphic_canvas != NULL) ? dogmGraphic_canvas->width : DOGM_DISPLAY_WIDTH;
+    uint8_t height = (dogmGraphic_canvas != NULL) ? dogmGraphic_canvas->height : DOGM_DISPLAY_HEIGHT;
+    clipRect_t *clip = &dogmGraphic_clip;
+    clip->x0 = x0;
+    clip->y0 = y0;
+    clip->x1 = (x1 < width) ? x1 : (width - 1);
+    clip->y1 = (y1 < height) ? y1 : (height - 1);
+}
+
+void dogmGraphic_resetClip(void) {
+    dogmGraphic_setClip(0, 0, DOGM_DISPLAY_WIDTH - 1, DOGM_DISPLAY_HEIGHT - 1);
+}
+
+inline clipRect_t dogmGraphic_getClip(void) {
+    return dogmGraphic_clip;
 }
 
 uint8_t dogmGraphic_generateByte(uint8_t number, uint8_t leftHand) {
@@ -136,48 +890,408 @@ void dogmGraphic_setVerticalPattern(uint8_t *verticalPattern, uint8_t startVerti
     }
 }
 
-void dogmGraphic_drawArea(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
-                          dogmGraphic_drawType_t type) {
-    if (!dogmGraphic_testHeight(start_y) || !dogmGraphic_testWidth(start_x)) {
-        logging_printString_P(LOG_WARNING, PSTR("Draw Area; StartPos out of range"));
-        return;
+/*! @brief ram row of a row of the drawing target
+ *
+ * @param y     row inside of the clip rectangle
+ * @return      row of the scrolled display ram or of the canvas
+ */
+static inline uint8_t dogmGraphic_row(uint8_t y) {
+    if (dogmGraphic_canvas != NULL) {
+        return y;
+    }
+    return (uint8_t) ((y + dogmGraphic_scrollOffset) & (DOGM_DISPLAY_HEIGHT - 1));
+}
+
+/*! @brief number of ram rows up to the end of the drawing target
+ *
+ * @param row   ram row
+ * @return      rows, which can be drawn without wrapping around the end of the display ram
+ */
+static inline uint8_t dogmGraphic_rowsToEnd(uint8_t row) {
+    return (dogmGraphic_canvas != NULL) ? 0xFF : (uint8_t) (DOGM_DISPLAY_HEIGHT - row);
+}
+
+/*! @brief first byte of a page of the drawing target
+ *
+ * @param page  page of the display ram or of the canvas
+ */
+static inline uint8_t *dogmGraphic_page(uint8_t page) {
+    if (dogmGraphic_canvas != NULL) {
+        return dogmGraphic_canvas->buffer + page * dogmGraphic_canvas->width;
+    }
+#if DOGM_GRAY_PLANES
+    if (dogmGraphic_plane < (DOGM_GRAY_PLANES - 1)) {
+        return dogmGraphic_display->gray[dogmGraphic_plane][page];
+    }
+#endif
+    return display_content[page];
+}
+
+/*! @brief mark changed columns of the drawing target
+ *
+ * A canvas is never flushed, so only the display ram has to remember its changes.
+ */
+static inline void dogmGraphic_markColumns(uint8_t page, uint8_t start, uint8_t end) {
+    if (dogmGraphic_canvas != NULL) {
+        return;
+    }
+#if DOGM_GRAY_PLANES
+    if (dogmGraphic_plane < (DOGM_GRAY_PLANES - 1)) {
+        dogmGraphic_mergeColumns(dogmGraphic_display->grayColumns, &dogmGraphic_display->grayPages, page, start, end);
+        return;
+    }
+#endif
+    dogmGraphic_setNewContentColumns(page, start, end);
+}
+
+/*! @brief bits of a page from the given bit on
+ */
+static const uint8_t dogmGraphic_maskFrom[8] = {0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80};
+
+/*! @brief bits of a page up to the given bit
+ */
+static const uint8_t dogmGraphic_maskTo[8] = {0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF};
+
+/*! @brief set the mask bits in a row of columns
+ *
+ * @param column    first column of one page
+ * @param width     number of columns, at least one
+ * @param mask      bits to set
+ */
+static inline void dogmGraphic_spanAdd(uint8_t *column, uint8_t width, uint8_t mask) {
+    if (mask == 0xFF) {
+        // full page, nothing to keep
+        memset(column, 0xFF, width);
+        return;
+    }
+    do {
+        *column++ |= mask;
+    } while (--width);
+}
+
+/*! @brief clear the mask bits in a row of columns
+ *
+ * @param column    first column of one page
+ * @param width     number of columns, at least one
+ * @param mask      bits to clear
+ */
+static inline void dogmGraphic_spanClear(uint8_t *column, uint8_t width, uint8_t mask) {
+    if (mask == 0xFF) {
+        memset(column, 0x00, width);
+        return;
+    }
+    mask = (uint8_t) ~mask;
+    do {
+        *column++ &= mask;
+    } while (--width);
+}
+
+/*! @brief invert the mask bits in a row of columns
+ *
+ * @param column    first column of one page
+ * @param width     number of columns, at least one
+ * @param mask      bits to invert
+ */
+static inline void dogmGraphic_spanInvert(uint8_t *column, uint8_t width, uint8_t mask) {
+    do {
+        *column++ ^= mask;
+    } while (--width);
+}
+
+void dogmGraphic_drawArea(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                          dogmGraphic_drawType_t type) {
+    if (!dogmGraphic_testHeight(start_y) || !dogmGraphic_testWidth(start_x)) {
+        logging_printString_P(LOG_WARNING, PSTR("Draw Area; StartPos out of range"));
+        return;
+    }
+    if (!deltaWidth || !deltaHeight) {
+        return;
+    }
+    dogmGraphic_fillClipped(start_x, start_y, (int16_t) (start_x + deltaWidth - 1),
+                            (int16_t) (start_y + deltaHeight - 1), type);
+}
+
+/*! @brief fill the visible part of an area
+ *
+ * @param x0    first column, may be outside of the display
+ * @param y0    first row, may be outside of the display
+ * @param x1    last column, may be outside of the display
+ * @param y1    last row, may be outside of the display
+ * @param type  drawing type
+ */
+static void dogmGraphic_fillClipped(int16_t x0, int16_t y0, int16_t x1, int16_t y1, dogmGraphic_drawType_t type) {
+    if (!dogmGraphic_clipArea(&x0, &y0, &x1, &y1)) {
+        return;
+    }
+    dogmGraphic_fillRows((uint8_t) x0, (uint8_t) y0, (uint8_t) (x1 - x0 + 1), (uint8_t) (y1 - y0 + 1), type);
+}
+
+/*! @brief cut an area to the clip rectangle
+ *
+ * @param x0    first column, may be outside of the display
+ * @param y0    first row, may be outside of the display
+ * @param x1    last column, may be outside of the display
+ * @param y1    last row, may be outside of the display
+ * @return      0, if nothing of the area is visible
+ */
+static uint8_t dogmGraphic_clipArea(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1) {
+    const clipRect_t *clip = &dogmGraphic_clip;
+    if (*x0 < clip->x0) {
+        *x0 = clip->x0;
+    }
+    if (*y0 < clip->y0) {
+        *y0 = clip->y0;
+    }
+    if (*x1 > clip->x1) {
+        *x1 = clip->x1;
+    }
+    if (*y1 > clip->y1) {
+        *y1 = clip->y1;
     }
-    uint8_t max_height = ((start_y + deltaHeight) >= DOGM_DISPLAY_HEIGHT) ? DOGM_DISPLAY_HEIGHT - 1 : (start_y +
-                                                                                                       deltaHeight);
+    return (*x0 <= *x1) && (*y0 <= *y1);
+}
+
+/*! @brief fill an area inside of the display without clipping
+ *
+ * @param start_x       horizontal start
+ * @param start_y       vertical start
+ * @param deltaWidth    width, the area ends inside of the display
+ * @param deltaHeight   height, the area ends inside of the display
+ * @param type          drawing type
+ */
+static void dogmGraphic_fillRows(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                                 dogmGraphic_drawType_t type) {
+    // a scrolled area may wrap around the end of the ram
+    uint8_t row = dogmGraphic_row(start_y);
+    uint8_t first = dogmGraphic_rowsToEnd(row);
+    if (deltaHeight <= first) {
+        dogmGraphic_drawAreaRows(start_x, row, deltaWidth, deltaHeight, type);
+    }
+    else {
+        dogmGraphic_drawAreaRows(start_x, row, deltaWidth, first, type);
+        dogmGraphic_drawAreaRows(start_x, 0, deltaWidth, deltaHeight - first, type);
+    }
+}
+
+/*! @brief draw area in ram rows
+ *
+ * @param start_x       horizontal start
+ * @param row           first ram row, the scroll offset is already added
+ * @param deltaWidth    width
+ * @param deltaHeight   height, the area does not wrap around the end of the ram
+ * @param type          drawing type
+ */
+static void dogmGraphic_drawAreaRows(uint8_t start_x, uint8_t row, uint8_t deltaWidth, uint8_t deltaHeight,
+                                     dogmGraphic_drawType_t type) {
     uint8_t max_width = ((start_x + deltaWidth) >= DOGM_DISPLAY_WIDTH) ? DOGM_DISPLAY_WIDTH : (start_x + deltaWidth);
+    if (!deltaHeight || (start_x >= max_width)) {
+        return;
+    }
+    if (type > DOGM_SET) {
+        logging_printString_P(LOG_WARNING, PSTR("Draw Area; DrawType unknown"));
+        return;
+    }
+    uint8_t width = max_width - start_x;
+
+    // last row, so an area ending on a page border does not mark the next page
+    uint8_t max_height = row + deltaHeight - 1;
+    uint8_t firstPage = row >> 3; // divide by 8
+    uint8_t lastPage = max_height >> 3; // divide by 8
 
-    uint8_t vertical_pattern[DOGM_DISPLAY_PAGES];
-    dogmGraphic_setVerticalPattern(vertical_pattern, start_y, deltaHeight);
+    for (uint8_t page = firstPage; page <= lastPage; page++) {
+        uint8_t mask = 0xFF;
+        if (page == firstPage) {
+            mask &= dogmGraphic_maskFrom[row & 0x07];
+        }
+        if (page == lastPage) {
+            mask &= dogmGraphic_maskTo[max_height & 0x07];
+        }
+        uint8_t *column = dogmGraphic_page(page) + start_x;
+
+        // an area sets the same bits, it clears before, so DOGM_SET is the same as DOGM_ADD
+        switch (type) {
+            case DOGM_ADD:
+            case DOGM_SET:
+                dogmGraphic_spanAdd(column, width, mask);
+                break;
+            case DOGM_CLEAR:
+                dogmGraphic_spanClear(column, width, mask);
+                break;
+            default:
+                dogmGraphic_spanInvert(column, width, mask);
+        }
+        dogmGraphic_markColumns(page, start_x, max_width - 1);
+    }
+}
 
-    dogmGraphic_setWritePointer(start_x, start_y);
-    for (; dogmGraphic_writePointer.height.page <= (max_height >> 3); dogmGraphic_writePointer.height.page++) {
-        for (dogmGraphic_writePointer.width = start_x;
-             dogmGraphic_writePointer.width < max_width; dogmGraphic_writePointer.width++) {
+/*! @brief ordered dither thresholds of an 8x8 bayer matrix, row by row
+ */
+static const uint8_t dogmGraphic_bayer[8][8] PROGMEM = {
+        {0,  32, 8,  40, 2,  34, 10, 42},
+        {48, 16, 56, 24, 50, 18, 58, 26},
+        {12, 44, 4,  36, 14, 46, 6,  38},
+        {60, 28, 52, 20, 62, 30, 54, 22},
+        {3,  35, 11, 43, 1,  33, 9,  41},
+        {51, 19, 59, 27, 49, 17, 57, 25},
+        {15, 47, 7,  39, 13, 45, 5,  37},
+        {63, 31, 55, 23, 61, 29, 53, 21}};
 
-            switch (type) {
-                case DOGM_ADD:
-                    display_content[dogmGraphic_writePointer.height.page][dogmGraphic_writePointer.width] |=
-                            vertical_pattern[dogmGraphic_writePointer.height.page];
-                    break;
-                case DOGM_CLEAR:
-                    display_content[dogmGraphic_writePointer.height.page][dogmGraphic_writePointer.width] &=
-                            ~vertical_pattern[dogmGraphic_writePointer.height.page];
-                    break;
-                case DOGM_INVERT:
-                    display_content[dogmGraphic_writePointer.height.page][dogmGraphic_writePointer.width] ^=
-                            vertical_pattern[dogmGraphic_writePointer.height.page];
-                    break;
-                case DOGM_SET:
-                    display_content[dogmGraphic_writePointer.height.page][dogmGraphic_writePointer.width] &=
-                            ~vertical_pattern[dogmGraphic_writePointer.height.page];
-                    display_content[dogmGraphic_writePointer.height.page][dogmGraphic_writePointer.width] |=
-                            vertical_pattern[dogmGraphic_writePointer.height.page];
-                    break;
-                default:
-                    logging_printString_P(LOG_WARNING, PSTR("Draw Area; DrawType unknown"));
+void dogmGraphic_setDitherPattern(uint8_t *pattern, uint8_t level) {
+    for (uint8_t x = 0; x < 8; x++) {
+        uint8_t value = 0;
+        for (uint8_t y = 0; y < 8; y++) {
+            if (pgm_read_byte(&dogmGraphic_bayer[y][x]) < level) {
+                value |= (uint8_t) (1 << y);
             }
         }
-        dogmGraphic_setNewContent(dogmGraphic_writePointer.height.page);
+        pattern[x] = value;
+    }
+}
+
+void dogmGraphic_setHatchPattern(uint8_t *pattern, dogmGraphic_hatch_t hatch) {
+    for (uint8_t x = 0; x < 8; x++) {
+        uint8_t value;
+        switch (hatch) {
+            case DOGM_HATCH_HORIZONTAL:
+                value = 0x11;
+                break;
+            case DOGM_HATCH_VERTICAL:
+                value = (x & 0x03) ? 0x00 : 0xFF;
+                break;
+            case DOGM_HATCH_DIAGONAL_DOWN:
+                value = (uint8_t) (0x11 << (x & 0x03));
+                break;
+            case DOGM_HATCH_DIAGONAL_UP:
+                value = (uint8_t) (0x11 << ((4 - x) & 0x03));
+                break;
+            case DOGM_HATCH_CROSS:
+                value = (x & 0x03) ? 0x11 : 0xFF;
+                break;
+            default:
+                value = (x & 0x01) ? 0xAA : 0x55;
+        }
+        pattern[x] = value;
+    }
+}
+
+void dogmGraphic_drawPatternArea(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                                 const uint8_t *pattern, dogmGraphic_drawType_t type) {
+    if (!dogmGraphic_testHeight(start_y) || !dogmGraphic_testWidth(start_x)) {
+        logging_printString_P(LOG_WARNING, PSTR("Draw Pattern; StartPos out of range"));
+        return;
+    }
+    if (type > DOGM_SET) {
+        logging_printString_P(LOG_WARNING, PSTR("Draw Pattern; DrawType unknown"));
+        return;
+    }
+    if (!deltaWidth || !deltaHeight) {
+        return;
+    }
+    int16_t x0 = start_x;
+    int16_t y0 = start_y;
+    int16_t x1 = (int16_t) (start_x + deltaWidth - 1);
+    int16_t y1 = (int16_t) (start_y + deltaHeight - 1);
+    if (!dogmGraphic_clipArea(&x0, &y0, &x1, &y1)) {
+        return;
+    }
+
+    // the pattern is fixed to the x/y coordinates, so rotate its rows to the scrolled ram rows
+    uint8_t shift = dogmGraphic_row(0) & 0x07;
+    uint8_t rotated[8];
+    for (uint8_t i = 0; i < 8; i++) {
+        rotated[i] = shift ? (uint8_t) ((pattern[i] << shift) | (pattern[i] >> (8 - shift))) : pattern[i];
+    }
+
+    // a scrolled area may wrap around the end of the ram
+    uint8_t width = (uint8_t) (x1 - x0 + 1);
+    uint8_t height = (uint8_t) (y1 - y0 + 1);
+    uint8_t row = dogmGraphic_row((uint8_t) y0);
+    uint8_t first = dogmGraphic_rowsToEnd(row);
+    if (height <= first) {
+        dogmGraphic_patternRows((uint8_t) x0, row, width, height, rotated, type);
+    }
+    else {
+        dogmGraphic_patternRows((uint8_t) x0, row, width, first, rotated, type);
+        dogmGraphic_patternRows((uint8_t) x0, 0, width, height - first, rotated, type);
+    }
+}
+
+/*! @brief draw a pattern in ram rows
+ *
+ * @param start_x       horizontal start
+ * @param row           first ram row, the scroll offset is already added
+ * @param deltaWidth    width, the area ends inside of the drawing target
+ * @param deltaHeight   height, the area does not wrap around the end of the ram
+ * @param pattern       pattern bytes, already rotated to the ram rows
+ * @param type          drawing type
+ *
+ * Each column combines one pattern byte with the page mask, so a pattern costs the same as a solid area.
+ */
+static void dogmGraphic_patternRows(uint8_t start_x, uint8_t row, uint8_t deltaWidth, uint8_t deltaHeight,
+                                    const uint8_t *pattern, dogmGraphic_drawType_t type) {
+    uint8_t max_height = row + deltaHeight - 1;
+    uint8_t firstPage = row >> 3; // divide by 8
+    uint8_t lastPage = max_height >> 3; // divide by 8
+
+    for (uint8_t page = firstPage; page <= lastPage; page++) {
+        uint8_t mask = 0xFF;
+        if (page == firstPage) {
+            mask &= dogmGraphic_maskFrom[row & 0x07];
+        }
+        if (page == lastPage) {
+            mask &= dogmGraphic_maskTo[max_height & 0x07];
+        }
+        uint8_t *column = dogmGraphic_page(page) + start_x;
+        uint8_t x = start_x;
+        uint8_t width = deltaWidth;
+
+        // one loop per draw type, like the kernels of a solid area
+        switch (type) {
+            case DOGM_ADD:
+                do {
+                    *column++ |= pattern[x++ & 0x07] & mask;
+                } while (--width);
+                break;
+            case DOGM_CLEAR:
+                do {
+                    *column++ &= (uint8_t) ~(pattern[x++ & 0x07] & mask);
+                } while (--width);
+                break;
+            case DOGM_INVERT:
+                do {
+                    *column++ ^= pattern[x++ & 0x07] & mask;
+                } while (--width);
+                break;
+            default:
+                do {
+                    *column = (*column & (uint8_t) ~mask) | (pattern[x++ & 0x07] & mask);
+                    column++;
+                } while (--width);
+        }
+        dogmGraphic_markColumns(page, start_x, start_x + deltaWidth - 1);
+    }
+}
+
+/*! @brief set one pixel without any range check
+ *
+ * @param x     horizontal position inside of the clip rectangle
+ * @param y     vertical position inside of the clip rectangle
+ */
+static inline void dogmGraphic_plot(uint8_t x, uint8_t y) {
+    uint8_t row = dogmGraphic_row(y);
+    dogmGraphic_page(row >> 3)[x] |= (uint8_t) (1 << (row & 0x07)); // divide and modulo 8
+    dogmGraphic_markColumns(row >> 3, x, x);
+}
+
+/*! @brief set one pixel, if it is inside of the clip rectangle
+ *
+ * @param x     horizontal position, may be outside of the display
+ * @param y     vertical position, may be outside of the display
+ */
+static inline void dogmGraphic_plotClipped(int16_t x, int16_t y) {
+    const clipRect_t *clip = &dogmGraphic_clip;
+    if ((x >= clip->x0) && (x <= clip->x1) && (y >= clip->y0) && (y <= clip->y1)) {
+        dogmGraphic_plot((uint8_t) x, (uint8_t) y);
     }
 }
 
@@ -186,26 +1300,121 @@ void dogmGraphic_drawDot(uint8_t x, uint8_t y) {
         logging_printString_P(LOG_WARNING, PSTR("Draw Dot; StartPos out of range"));
         return;
     }
-    dogmGraphic_setWritePointer(x, y);
-    display_content[dogmGraphic_writePointer.height.page][x] |= (uint8_t) (1 << (y & 0x07));
-
-    dogmGraphic_setNewContent(dogmGraphic_writePointer.height.page);
+    dogmGraphic_plotClipped(x, y);
 }
 
 inline int8_t dogmGraphic_sgn(int8_t x) {
     return (x > 0) ? 1 : (x < 0) ? -1 : 0;
 }
 
+/*! @brief outcode bits of the Cohen-Sutherland algorithm
+ */
+#define DOGM_CLIP_LEFT      0x01
+#define DOGM_CLIP_RIGHT     0x02
+#define DOGM_CLIP_TOP       0x04
+#define DOGM_CLIP_BOTTOM    0x08
+
+/*! @brief Cohen-Sutherland outcode of a point
+ *
+ * @param x     horizontal position
+ * @param y     vertical position
+ * @return      DOGM_CLIP_* bits of the borders, the point is outside of
+ */
+static inline uint8_t dogmGraphic_outcode(uint8_t x, uint8_t y) {
+    const clipRect_t *clip = &dogmGraphic_clip;
+    uint8_t code = 0;
+    if (x < clip->x0) {
+        code |= DOGM_CLIP_LEFT;
+    }
+    else if (x > clip->x1) {
+        code |= DOGM_CLIP_RIGHT;
+    }
+    if (y < clip->y0) {
+        code |= DOGM_CLIP_TOP;
+    }
+    else if (y > clip->y1) {
+        code |= DOGM_CLIP_BOTTOM;
+    }
+    return code;
+}
+
+/*! @brief steps of one axis inside of the clip rectangle
+ *
+ * @param start     start position
+ * @param inc       direction of the steps, -1, 0 or 1
+ * @param min       first visible position
+ * @param max       last visible position
+ * @param first     first visible step, may be negative
+ * @param last      last visible step
+ * @return          0, if no step is visible
+ */
+static uint8_t dogmGraphic_clipSteps(uint8_t start, int8_t inc, uint8_t min, uint8_t max, int16_t *first,
+                                     int16_t *last) {
+    if (inc > 0) {
+        *first = (int16_t) min - start;
+        *last = (int16_t) max - start;
+    }
+    else if (inc < 0) {
+        *first = (int16_t) start - max;
+        *last = (int16_t) start - min;
+    }
+    else {
+        *first = 0;
+        *last = INT16_MAX;
+        return (start >= min) && (start <= max);
+    }
+    return *last >= 0;
+}
+
+/*! @brief draw a run of a line
+ *
+ * @param fast  1, if x is the fast direction
+ * @param run   fast position of the first pixel of the run
+ * @param x     horizontal position of the last pixel of the run
+ * @param y     vertical position of the last pixel of the run
+ *
+ * A run of a mostly horizontal line sets one bit in a row of columns, a run of a mostly vertical line sets the bits of
+ * one column page by page. All pixels are inside of the clip rectangle.
+ */
+static inline void dogmGraphic_drawRun(uint8_t fast, int16_t run, int16_t x, int16_t y) {
+    if (fast) {
+        uint8_t x0 = (uint8_t) ((run < x) ? run : x);
+        uint8_t x1 = (uint8_t) ((run < x) ? x : run);
+        uint8_t row = dogmGraphic_row((uint8_t) y);
+        dogmGraphic_spanAdd(dogmGraphic_page(row >> 3) + x0, x1 - x0 + 1, (uint8_t) (1 << (row & 0x07)));
+        dogmGraphic_markColumns(row >> 3, x0, x1);
+    }
+    else {
+        uint8_t y0 = (uint8_t) ((run < y) ? run : y);
+        uint8_t y1 = (uint8_t) ((run < y) ? y : run);
+        dogmGraphic_fillRows((uint8_t) x, y0, 1, y1 - y0 + 1, DOGM_ADD);
+    }
+}
+
 void dogmGraphic_drawLineXY(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint8_t lineType) {
-    int8_t x, y, t, dx, dy, incx, incy, pdx, pdy, ddx, ddy, es, el, err;
+    int16_t x, y, dx, dy;
+    int8_t incx, incy, pdx, pdy, ddx, ddy;
+    uint8_t es, el, err0;
+
+    if (lineType > 2) {
+        logging_printString_P(LOG_WARNING, PSTR("Draw Line; LineType unknown"));
+        return;
+    }
+
+    // trivial reject, both points are outside of the same border
+    uint8_t startCode = dogmGraphic_outcode(start_x, start_y);
+    uint8_t endCode = dogmGraphic_outcode(end_x, end_y);
+    if (startCode & endCode) {
+        return;
+    }
 
     /* Entfernung in beiden Dimensionen berechnen */
-    dx = end_x - start_x;
-    dy = end_y - start_y;
+    dx = (int16_t) end_x - start_x;
+    dy = (int16_t) end_y - start_y;
 
     /* Vorzeichen des Inkrements bestimmen */
-    incx = dogmGraphic_sgn(dx);
-    incy = dogmGraphic_sgn(dy);
+    incx = (dx > 0) ? 1 : (dx < 0) ? -1 : 0;
+    incy = (dy > 0) ? 1 : (dy < 0) ? -1 : 0;
     if (dx < 0) { dx = -dx; }
     if (dy < 0) { dy = -dy; }
 
@@ -216,27 +1425,111 @@ void dogmGraphic_drawLineXY(uint8_t start_x, uint8_t start_y, uint8_t end_x, uin
         pdy = 0;    /* pd. ist Parallelschritt */
         ddx = incx;
         ddy = incy; /* dd. ist Diagonalschritt */
-        es = dy;
-        el = dx;   /* Fehlerschritte schnell, langsam */
+        es = (uint8_t) dy;
+        el = (uint8_t) dx;   /* Fehlerschritte schnell, langsam */
     } else {
         /* y ist schnelle Richtung */
         pdx = 0;
         pdy = incy; /* pd. ist Parallelschritt */
         ddx = incx;
         ddy = incy; /* dd. ist Diagonalschritt */
-        es = dx;
-        el = dy;   /* Fehlerschritte schnell, langsam */
+        es = (uint8_t) dx;
+        el = (uint8_t) dy;   /* Fehlerschritte schnell, langsam */
+    }
+    err0 = el >> 1; // divide by 2
+    uint8_t fast = (dx > dy);
+
+    /*
+     * Step t of the loop has done d(t) = (t * es - err0 + el - 1) / el slow steps. The visible steps are the ones with
+     * a fast position and a slow position inside of the clip rectangle, so the loop starts at the first of them with
+     * the same error term as the unclipped line.
+     */
+    int16_t first = 0;
+    int16_t last = el;
+    if (startCode | endCode) {
+        int16_t low, high;
+        const clipRect_t *clip = &dogmGraphic_clip;
+
+        // fast direction
+        if (!dogmGraphic_clipSteps(fast ? start_x : start_y, fast ? incx : incy, fast ? clip->x0 : clip->y0,
+                                   fast ? clip->x1 : clip->y1, &low, &high)) {
+            return;
+        }
+        if (low > first) {
+            first = low;
+        }
+        if (high < last) {
+            last = high;
+        }
+
+        // slow direction, the number of slow steps limits the fast steps
+        if (!dogmGraphic_clipSteps(fast ? start_y : start_x, fast ? incy : incx, fast ? clip->y0 : clip->x0,
+                                   fast ? clip->y1 : clip->x1, &low, &high)) {
+            return;
+        }
+        if (es) {
+            if (low > es) {
+                return;
+            }
+            if (low > 0) {
+                int16_t t = (int16_t) (((uint16_t) (low - 1) * el + err0 + es) / es);
+                if (t > first) {
+                    first = t;
+                }
+            }
+            if (high < es) {
+                int16_t t = (int16_t) (((uint16_t) high * el + err0) / es);
+                if (t < last) {
+                    last = t;
+                }
+            }
+        }
+        if (first > last) {
+            return;
+        }
     }
 
     /* Initialisierungen vor Schleifenbeginn */
-    x = start_x;
-    y = start_y;
-    err = el >> 1; // divide by 2
-    dogmGraphic_drawDot((uint8_t) x, (uint8_t) y);
+    uint16_t steps = (uint16_t) first * es;
+    uint8_t slow = el ? (uint8_t) ((steps + el - 1 - err0) / el) : 0;
+    int16_t err = (int16_t) ((uint16_t) slow * el + err0 - steps);
+    x = start_x + pdx * (first - slow) + ddx * slow;
+    y = start_y + pdy * (first - slow) + ddy * slow;
+
+    if (!lineType) {
+        // a filled line is drawn in runs of pixels with the same slow position
+        int16_t run = fast ? x : y;
+        for (int16_t t = first;; ++t) {
+            if (t == last) {
+                dogmGraphic_drawRun(fast, run, x, y);
+                break;
+            }
+            err -= es;
+            if (err < 0) {
+                err += el;
+                dogmGraphic_drawRun(fast, run, x, y);
+                x += ddx;
+                y += ddy;
+                run = fast ? x : y;
+            } else {
+                x += pdx;
+                y += pdy;
+            }
+        }
+        return;
+    }
 
     /* Pixel berechnen */
-    for (t = 0; t < el; ++t) /* t zaehlt die Pixel, el ist auch Anzahl */
+    for (int16_t t = first;; ++t) /* t zaehlt die Pixel */
     {
+        // the start point always, dotted uses bit 0 and dashed bit 1 of the previous step
+        if (!t || ((t - 1) & lineType)) {
+            dogmGraphic_plot((uint8_t) x, (uint8_t) y);
+        }
+        if (t == last) {
+            break;
+        }
+
         /* Aktualisierung Fehlerterm */
         err -= es;
         if (err < 0) {
@@ -250,146 +1543,1456 @@ void dogmGraphic_drawLineXY(uint8_t start_x, uint8_t start_y, uint8_t end_x, uin
             x += pdx;
             y += pdy;
         }
-
-        switch (lineType) {
-            case 0: // filled
-                dogmGraphic_drawDot((uint8_t) x, (uint8_t) y);
-                break;
-            case 1: // dotted
-                if (t & 0x01) {
-                    dogmGraphic_drawDot((uint8_t) x, (uint8_t) y);
-                }
-                break;
-            case 2: // dashed
-                if ((t & 0x02)) {
-                    dogmGraphic_drawDot((uint8_t) x, (uint8_t) y);
-                }
-                break;
-            default:
-                logging_printString_P(LOG_WARNING, PSTR("Draw Line; LineType unknown"));
-        }
     }
 }
 
 void dogmGraphic_drawCircleOutline(uint8_t start_x, uint8_t start_y, uint8_t radius, uint8_t filled) {
-    int8_t f = 1 - radius;
-    int8_t ddF_x = 0;
-    int8_t ddF_y = 1 - (radius << 1); // Multiply by -2
-    int8_t x = 0;
-    int8_t y = radius;
-
-    dogmGraphic_drawDot(start_x, start_y + radius);
-    dogmGraphic_drawDot(start_x, start_y - radius);
-    dogmGraphic_drawDot(start_x + radius, start_y);
-    dogmGraphic_drawDot(start_x - radius, start_y);
-
-    while (x < y) {
-        if (f >= 0) {
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x + 1;
+    dogmGraphic_drawEllipse(start_x, start_y, radius, radius, filled);
+}
 
-        if (filled) {
-            //first line
-            dogmGraphic_drawLineXY(start_x, start_y - y, start_x, start_y + y, 0);
-            //middle
-            dogmGraphic_drawLineXY(start_x + x, start_y - y, start_x + x, start_y + y, 0);
-            dogmGraphic_drawLineXY(start_x - x, start_y + y, start_x - x, start_y - y, 0);
-            //end
-            dogmGraphic_drawLineXY(start_x + y, start_y - x, start_x + y, start_y + x, 0);
-            dogmGraphic_drawLineXY(start_x - y, start_y + x, start_x - y, start_y - x, 0);
-        }
-        else {
-            dogmGraphic_drawDot(start_x + x, start_y + y);
-            dogmGraphic_drawDot(start_x - x, start_y + y);
+/*! @brief walk over the half heights of an ellipse column by column
+ *
+ * @param a2        square of the horizontal radius
+ * @param b2        square of the vertical radius
+ * @param limit     a pixel dx/dy belongs to the ellipse, if b2 * dx² + a2 * dy² <= limit
+ * @param fx        b2 * dx²
+ * @param fy        a2 * half²
+ * @param dx        actual column from the middle
+ * @param half      half height of the actual column
+ */
+typedef struct {
+    uint32_t a2;
+    uint32_t b2;
+    uint32_t limit;
+    uint32_t fx;
+    uint32_t fy;
+    int16_t dx;
+    int16_t half;
+    uint8_t radius_x;
+} dogmGraphic_ellipseWalk_t;
 
-            dogmGraphic_drawDot(start_x + x, start_y - y);
-            dogmGraphic_drawDot(start_x - x, start_y - y);
+/*! @brief start the walk with the middle column
+ *
+ * @param walk      walk to start
+ * @param radius_x  horizontal half diameter
+ * @param radius_y  vertical half diameter
+ */
+static void dogmGraphic_ellipseBegin(dogmGraphic_ellipseWalk_t *walk, uint8_t radius_x, uint8_t radius_y) {
+    walk->a2 = (uint32_t) radius_x * radius_x;
+    walk->b2 = (uint32_t) radius_y * radius_y;
 
-            dogmGraphic_drawDot(start_x + y, start_y + x);
-            dogmGraphic_drawDot(start_x - y, start_y + x);
+    // for a circle x² + y² <= r² + r
+    walk->limit = walk->a2 * walk->b2 + (((uint32_t) radius_x * radius_y * (radius_x + radius_y)) >> 1);
+    walk->fx = 0;
+    walk->fy = walk->a2 * walk->b2;
+    walk->dx = 0;
+    walk->half = radius_y;
+    walk->radius_x = radius_x;
+}
 
-            dogmGraphic_drawDot(start_x + y, start_y - x);
-            dogmGraphic_drawDot(start_x - y, start_y - x);
+/*! @brief step to the next column
+ *
+ * @param walk      started walk
+ * @return          half height of the next column, -1 behind the last column
+ *
+ * The half height only shrinks from the middle to the outside.
+ */
+static int16_t dogmGraphic_ellipseNext(dogmGraphic_ellipseWalk_t *walk) {
+    int16_t half = -1;
+    if (walk->dx < walk->radius_x) {
+        walk->fx += walk->b2 * (uint32_t) ((walk->dx << 1) + 1);
+        half = walk->half;
+        while (walk->fy > (walk->limit - walk->fx)) {
+            walk->fy -= walk->a2 * (uint32_t) ((half << 1) - 1);
+            half--;
         }
     }
+    walk->dx++;
+    walk->half = half;
+    return half;
 }
 
-void dogmGraphic_drawP(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
-                       dogmGraphic_drawType_t type, const void *progMemSpace) {
-    // proof of start point and size
-    if (
-            !dogmGraphic_testHeight(start_y) ||
-            !dogmGraphic_testWidth(start_x) ||
-            !dogmGraphic_testHeight(start_y + deltaHeight) ||
-            !dogmGraphic_testWidth(start_x + deltaWidth)
-        ) {
-        logging_printString_P(LOG_WARNING, PSTR("Draw PROGMEM; Position out of range"));
-        return;
-    }
-
-    uint8_t verticalPattern[DOGM_DISPLAY_PAGES];
-    dogmGraphic_setWritePointer(start_x, start_y);
-    dogmGraphic_setVerticalPattern(verticalPattern, start_y, deltaHeight);
-
-    // area for loop in pages
-    dogmGraphic_setWritePointer(start_x, start_y);
-    for (; dogmGraphic_writePointer.height.page <= ((start_y + deltaHeight) >> 3);
-           dogmGraphic_writePointer.height.page++) {
-        uint8_t page = dogmGraphic_writePointer.height.page;
-
-        //TODO: On occasion find the real problem
-        if (page >= (DOGM_DISPLAY_HEIGHT >> 3)) { // divide by 8
-            logging_printString_P(LOG_WARNING, PSTR("Draw PROGMEM; Page on 8 or higher"));
-            break;
-        }
-        for (uint8_t i = start_x; i < (start_x + deltaWidth); i++) {
+void dogmGraphic_drawEllipse(uint8_t start_x, uint8_t start_y, uint8_t radius_x, uint8_t radius_y, uint8_t filled) {
+    dogmGraphic_ellipseWalk_t walk;
+    dogmGraphic_ellipseBegin(&walk, radius_x, radius_y);
+    int16_t cx = start_x;
+    int16_t cy = start_y;
+    int16_t half = radius_y;
 
-            uint8_t writeContent = 0;
-            if ((start_y >> 3) == ((start_y + deltaHeight) >> 3)) { // divide by 8
-                // start page == end page
-                writeContent = ((pgm_read_byte(progMemSpace)) << dogmGraphic_writePointer.height.bit);
-                writeContent &= dogmGraphic_generateByte(dogmGraphic_writePointer.height.bit + deltaHeight, 1);
-            }
-            else if (page == (start_y >> 3)) { // divide by 8
-                // start page
-                writeContent = ((pgm_read_byte(progMemSpace)) << dogmGraphic_writePointer.height.bit);
-            }
-            else if (page < ((start_y + deltaHeight) >> 3)) { // divide by 8
-                // between start and end page
-                writeContent = ((pgm_read_byte(progMemSpace - deltaWidth)) >>
-                                (8 - dogmGraphic_writePointer.height.bit));
-                writeContent |= ((pgm_read_byte(progMemSpace)) << dogmGraphic_writePointer.height.bit);
-            }
-            else {
-                writeContent = ((pgm_read_byte(progMemSpace - deltaWidth)) >>
-                                (8 - dogmGraphic_writePointer.height.bit));
-            }
+    // one vertical span per column and side
+    for (int16_t dx = 0; dx <= radius_x; dx++) {
+        int16_t next = dogmGraphic_ellipseNext(&walk);
 
-            switch (type) {
-                case DOGM_ADD:
-                    display_content[page][i] |= (writeContent & verticalPattern[page]);
-                    break;
-                case DOGM_CLEAR: // not needed in this case
-                    break;
-                case DOGM_INVERT:
-                    display_content[page][i] &= ~verticalPattern[page];
-                    writeContent ^= verticalPattern[page];
-                    display_content[page][i] |= writeContent;
-                    break;
-                case DOGM_SET:
-                    display_content[page][i] &= ~verticalPattern[page];
-                    display_content[page][i] |= (writeContent & verticalPattern[page]);
-                    break;
-                default:
-                    logging_printString_P(LOG_WARNING, PSTR("Draw PROGMEM; DrawType unknown"));
+        if (filled) {
+            dogmGraphic_fillClipped(cx + dx, cy - half, cx + dx, cy + half, DOGM_ADD);
+            if (dx) {
+                dogmGraphic_fillClipped(cx - dx, cy - half, cx - dx, cy + half, DOGM_ADD);
             }
-            progMemSpace++;
         }
-        dogmGraphic_setNewContent(page);
+        else {
+            // the outline reaches down to the half height of the next column
+            int16_t inner = (next < half) ? (next + 1) : half;
+            dogmGraphic_fillClipped(cx + dx, cy - half, cx + dx, cy - inner, DOGM_ADD);
+            dogmGraphic_fillClipped(cx + dx, cy + inner, cx + dx, cy + half, DOGM_ADD);
+            if (dx) {
+                dogmGraphic_fillClipped(cx - dx, cy - half, cx - dx, cy - inner, DOGM_ADD);
+                dogmGraphic_fillClipped(cx - dx, cy + inner, cx - dx, cy + half, DOGM_ADD);
+            }
+        }
+        half = next;
     }
-}
\ No newline at end of file
+}
+
+/*! @brief rasterize a polygon edge into column ranges
+ *
+ * @param start_x   horizontal start position
+ * @param start_y   vertical start position
+ * @param end_x     horizontal end position
+ * @param end_y     vertical end position
+ * @param first     first visible column
+ * @param last      last visible column
+ * @param top       top row of every visible column, starting with first
+ * @param bottom    bottom row of every visible column, starting with first
+ *
+ * The rows are limited to -1 and DOGM_DISPLAY_HEIGHT, so they fit into int8_t and still lie outside of the display.
+ */
+static void dogmGraphic_polygonEdge(int16_t start_x, int16_t start_y, int16_t end_x, int16_t end_y, uint8_t first,
+                                    uint8_t last, int8_t *top, int8_t *bottom) {
+    int16_t dx = (int16_t) end_x - start_x;
+    int16_t dy = (int16_t) end_y - start_y;
+    int8_t incx = (dx > 0) ? 1 : (dx < 0) ? -1 : 0;
+    int8_t incy = (dy > 0) ? 1 : (dy < 0) ? -1 : 0;
+    int8_t pdx, pdy;
+    int16_t es, el;
+    if (dx < 0) { dx = -dx; }
+    if (dy < 0) { dy = -dy; }
+    if (dx > dy) {
+        pdx = incx;
+        pdy = 0;
+        es = dy;
+        el = dx;
+    }
+    else {
+        pdx = 0;
+        pdy = incy;
+        es = dx;
+        el = dy;
+    }
+
+    // the same steps as dogmGraphic_drawLineXY
+    int16_t x = start_x;
+    int16_t y = start_y;
+    int16_t err = el >> 1; // divide by 2
+    for (int16_t t = 0;; t++) {
+        if ((x >= first) && (x <= last)) {
+            int8_t row = (int8_t) ((y > DOGM_DISPLAY_HEIGHT) ? DOGM_DISPLAY_HEIGHT : (y < -1) ? -1 : y);
+            uint8_t i = (uint8_t) (x - first);
+            if (row < top[i]) {
+                top[i] = row;
+            }
+            if (row > bottom[i]) {
+                bottom[i] = row;
+            }
+        }
+        if (t == el) {
+            break;
+        }
+        err -= es;
+        if (err < 0) {
+            err += el;
+            x += incx;
+            y += incy;
+        }
+        else {
+            x += pdx;
+            y += pdy;
+        }
+    }
+}
+
+void dogmGraphic_drawPolygon(const coordinatePoint_t *points, uint8_t count, dogmGraphic_drawType_t type) {
+    if (!count) {
+        return;
+    }
+    if (type > DOGM_SET) {
+        logging_printString_P(LOG_WARNING, PSTR("Draw Polygon; DrawType unknown"));
+        return;
+    }
+
+    // clip the bounding box once
+    const clipRect_t *clip = &dogmGraphic_clip;
+    uint8_t min_x = points[0].x, max_x = points[0].x, min_y = points[0].y, max_y = points[0].y;
+    for (uint8_t i = 1; i < count; i++) {
+        if (points[i].x < min_x) { min_x = points[i].x; }
+        if (points[i].x > max_x) { max_x = points[i].x; }
+        if (points[i].y < min_y) { min_y = points[i].y; }
+        if (points[i].y > max_y) { max_y = points[i].y; }
+    }
+    uint8_t first = (min_x < clip->x0) ? clip->x0 : min_x;
+    uint8_t last = (max_x > clip->x1) ? clip->x1 : max_x;
+    if ((first > last) || (min_y > clip->y1) || (max_y < clip->y0)) {
+        return;
+    }
+
+    int8_t top[DOGM_DISPLAY_WIDTH];
+    int8_t bottom[DOGM_DISPLAY_WIDTH];
+    dogmGraphic_polygonBegin(first, last, top, bottom);
+    for (uint8_t i = 0; i < count; i++) {
+        const coordinatePoint_t *next = &points[(uint8_t) (i + 1) < count ? i + 1 : 0];
+        dogmGraphic_polygonEdge(points[i].x, points[i].y, next->x, next->y, first, last, top, bottom);
+    }
+    dogmGraphic_polygonSpans(first, last, top, bottom, type);
+}
+
+/*! @brief empty column ranges of a polygon
+ *
+ * @param first     first visible column
+ * @param last      last visible column
+ * @param top       top row of every visible column
+ * @param bottom    bottom row of every visible column
+ */
+static void dogmGraphic_polygonBegin(uint8_t first, uint8_t last, int8_t *top, int8_t *bottom) {
+    uint8_t count = (uint8_t) (last - first + 1);
+    memset(top, INT8_MAX, count);
+    memset(bottom, INT8_MIN, count);
+}
+
+/*! @brief fill the column ranges of a polygon
+ *
+ * @param first     first visible column
+ * @param last      last visible column
+ * @param top       top row of every visible column
+ * @param bottom    bottom row of every visible column
+ * @param type      drawing type
+ */
+static void dogmGraphic_polygonSpans(uint8_t first, uint8_t last, const int8_t *top, const int8_t *bottom,
+                                     dogmGraphic_drawType_t type) {
+    // one span per column
+    for (uint8_t x = first;; x++) {
+        uint8_t i = (uint8_t) (x - first);
+        if (top[i] <= bottom[i]) {
+            dogmGraphic_fillClipped(x, top[i], x, bottom[i], type);
+        }
+        if (x == last) {
+            break;
+        }
+    }
+}
+
+void dogmGraphic_drawTriangle(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2,
+                              dogmGraphic_drawType_t type) {
+    const coordinatePoint_t points[3] = {{x0, y0}, {x1, y1}, {x2, y2}};
+    dogmGraphic_drawPolygon(points, 3, type);
+}
+
+/*! @brief fill a convex quadrangle, whose corners may lie outside of the display
+ *
+ * @param corner_x  horizontal corner positions in drawing order
+ * @param corner_y  vertical corner positions in drawing order
+ */
+static void dogmGraphic_fillQuadrangle(const int16_t *corner_x, const int16_t *corner_y) {
+    const clipRect_t *clip = &dogmGraphic_clip;
+    int16_t min_x = corner_x[0], max_x = corner_x[0], min_y = corner_y[0], max_y = corner_y[0];
+    for (uint8_t i = 1; i < 4; i++) {
+        if (corner_x[i] < min_x) { min_x = corner_x[i]; }
+        if (corner_x[i] > max_x) { max_x = corner_x[i]; }
+        if (corner_y[i] < min_y) { min_y = corner_y[i]; }
+        if (corner_y[i] > max_y) { max_y = corner_y[i]; }
+    }
+    uint8_t first = (min_x < clip->x0) ? clip->x0 : (uint8_t) min_x;
+    uint8_t last = (max_x > clip->x1) ? clip->x1 : (uint8_t) max_x;
+    if ((min_x > clip->x1) || (max_x < clip->x0) || (min_y > clip->y1) || (max_y < clip->y0)) {
+        return;
+    }
+
+    int8_t top[DOGM_DISPLAY_WIDTH];
+    int8_t bottom[DOGM_DISPLAY_WIDTH];
+    dogmGraphic_polygonBegin(first, last, top, bottom);
+    for (uint8_t i = 0; i < 4; i++) {
+        uint8_t next = (i + 1) & 0x03;
+        dogmGraphic_polygonEdge(corner_x[i], corner_y[i], corner_x[next], corner_y[next], first, last, top, bottom);
+    }
+    dogmGraphic_polygonSpans(first, last, top, bottom, DOGM_ADD);
+}
+
+/*! @brief integer square root
+ *
+ * @param value     radicand
+ * @return          largest root, whose square is not above value
+ *
+ * The root is built two radicand bits per step with shifts and subtractions, which is cheaper on the AVR than a search
+ * with a multiplication per bit.
+ */
+static uint16_t dogmGraphic_sqrt(uint32_t value) {
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t) root;
+}
+
+/*! @brief rounded quotient
+ *
+ * @param numerator     signed dividend
+ * @param denominator   positive divisor
+ */
+static int16_t dogmGraphic_divRound(int32_t numerator, uint16_t denominator) {
+    int32_t half = denominator >> 1;
+    return (int16_t) ((numerator < 0) ? -((-numerator + half) / denominator) : ((numerator + half) / denominator));
+}
+
+void dogmGraphic_drawLineStroke(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint8_t width) {
+    dogmGraphic_strokeLine(start_x, start_y, end_x, end_y, width);
+}
+
+/*! @brief draw a line with a stroke width, whose ends may lie outside of the display
+ *
+ * @param start_x   horizontal start position, also negative
+ * @param start_y   vertical start position, also negative
+ * @param end_x     horizontal end position, also negative
+ * @param end_y     vertical end position, also negative
+ * @param width     stroke width in pixel
+ *
+ * A width of 1 is the plain line, as long as the ends fit into its coordinates. Otherwise it is a quadrangle without
+ * width, whose edges take the same steps.
+ */
+static void dogmGraphic_strokeLine(int16_t start_x, int16_t start_y, int16_t end_x, int16_t end_y, uint8_t width) {
+    if ((width <= 1) && !((start_x | start_y | end_x | end_y) & 0xFF00)) {
+        dogmGraphic_drawLineXY((uint8_t) start_x, (uint8_t) start_y, (uint8_t) end_x, (uint8_t) end_y, 0);
+        return;
+    }
+    // the rows and columns on both sides of the middle line, the upper or left side gets the odd one
+    int16_t low = (width > 1) ? (int16_t) ((width - 1) >> 1) : 0;
+    int16_t high = (width > 1) ? (int16_t) (width - 1 - low) : 0;
+    int16_t dx = end_x - start_x;
+    int16_t dy = end_y - start_y;
+
+    // straight lines and single points are areas
+    if (!dx || !dy) {
+        int16_t x0 = (start_x < end_x) ? start_x : end_x;
+        int16_t x1 = (start_x < end_x) ? end_x : start_x;
+        int16_t y0 = (start_y < end_y) ? start_y : end_y;
+        int16_t y1 = (start_y < end_y) ? end_y : start_y;
+        if (!dy) {
+            y0 -= high;
+            y1 += low;
+        }
+        if (!dx) {
+            x0 -= high;
+            x1 += low;
+        }
+        dogmGraphic_fillClipped(x0, y0, x1, y1, DOGM_ADD);
+        return;
+    }
+
+    // a quadrangle with the width perpendicular to the line
+    // the ends may be far outside of the display, so the square needs 32 bits
+    uint16_t length = dogmGraphic_sqrt((uint32_t) ((int32_t) dx * dx + (int32_t) dy * dy));
+    int16_t high_x = dogmGraphic_divRound((int32_t) dy * high, length);
+    int16_t high_y = dogmGraphic_divRound((int32_t) -dx * high, length);
+    int16_t low_x = dogmGraphic_divRound((int32_t) -dy * low, length);
+    int16_t low_y = dogmGraphic_divRound((int32_t) dx * low, length);
+    const int16_t corner_x[4] = {start_x + high_x, end_x + high_x, end_x + low_x, start_x + low_x};
+    const int16_t corner_y[4] = {start_y + high_y, end_y + high_y, end_y + low_y, start_y + low_y};
+    dogmGraphic_fillQuadrangle(corner_x, corner_y);
+}
+
+void dogmGraphic_drawRectangleStroke(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                                     uint8_t width) {
+    if (!deltaWidth || !deltaHeight || !width) {
+        return;
+    }
+    int16_t x0 = start_x;
+    int16_t y0 = start_y;
+    int16_t x1 = (int16_t) (start_x + deltaWidth - 1);
+    int16_t y1 = (int16_t) (start_y + deltaHeight - 1);
+
+    // a stroke as wide as half of the rectangle fills it
+    if (((width << 1) >= deltaWidth) || ((width << 1) >= deltaHeight)) {
+        dogmGraphic_fillClipped(x0, y0, x1, y1, DOGM_ADD);
+        return;
+    }
+    dogmGraphic_fillClipped(x0, y0, x1, y0 + width - 1, DOGM_ADD);
+    dogmGraphic_fillClipped(x0, y1 - width + 1, x1, y1, DOGM_ADD);
+    dogmGraphic_fillClipped(x0, y0 + width, x0 + width - 1, y1 - width, DOGM_ADD);
+    dogmGraphic_fillClipped(x1 - width + 1, y0 + width, x1, y1 - width, DOGM_ADD);
+}
+
+void dogmGraphic_drawCircleStroke(uint8_t start_x, uint8_t start_y, uint8_t radius, uint8_t width) {
+    dogmGraphic_drawEllipseStroke(start_x, start_y, radius, radius, width);
+}
+
+void dogmGraphic_drawEllipseStroke(uint8_t start_x, uint8_t start_y, uint8_t radius_x, uint8_t radius_y,
+                                   uint8_t width) {
+    if (width <= 1) {
+        dogmGraphic_drawEllipse(start_x, start_y, radius_x, radius_y, 0);
+        return;
+    }
+    if ((width > radius_x) || (width > radius_y)) {
+        dogmGraphic_drawEllipse(start_x, start_y, radius_x, radius_y, 1);
+        return;
+    }
+
+    // the ring between the outer ellipse and the inner one, which is smaller by the width
+    dogmGraphic_ellipseWalk_t outer;
+    dogmGraphic_ellipseWalk_t inner;
+    dogmGraphic_ellipseBegin(&outer, radius_x, radius_y);
+    dogmGraphic_ellipseBegin(&inner, radius_x - width, radius_y - width);
+    int16_t cx = start_x;
+    int16_t cy = start_y;
+    int16_t half = radius_y;
+    int16_t hole = radius_y - width;
+
+    for (int16_t dx = 0; dx <= radius_x; dx++) {
+        int16_t from = (hole < 0) ? -half : (hole + 1);
+        if (from <= half) {
+            dogmGraphic_fillClipped(cx + dx, cy + from, cx + dx, cy + half, DOGM_ADD);
+            if (dx) {
+                dogmGraphic_fillClipped(cx - dx, cy + from, cx - dx, cy + half, DOGM_ADD);
+            }
+        }
+        if (hole >= 0) {
+            dogmGraphic_fillClipped(cx + dx, cy - half, cx + dx, cy - hole - 1, DOGM_ADD);
+            if (dx) {
+                dogmGraphic_fillClipped(cx - dx, cy - half, cx - dx, cy - hole - 1, DOGM_ADD);
+            }
+        }
+        half = dogmGraphic_ellipseNext(&outer);
+        hole = dogmGraphic_ellipseNext(&inner);
+    }
+}
+
+/*! @brief sine of 0 to 90 degree in steps of 1 degree, 14 fraction bits
+ */
+static const uint16_t dogmGraphic_sine[91] PROGMEM = {
+            0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+         2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+         5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+         8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+        10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+        12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+        14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+        15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+        16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+        16384
+};
+
+/*! @brief bring an angle to 0 to 359 degree
+ */
+static uint16_t dogmGraphic_angle(int32_t angle) {
+    angle %= 360;
+    return (uint16_t) ((angle < 0) ? angle + 360 : angle);
+}
+
+int16_t dogmGraphic_sin(int16_t angle) {
+    uint16_t value = dogmGraphic_angle(angle);
+    uint8_t negative = (value >= 180);
+    if (negative) {
+        value -= 180;
+    }
+    if (value > 90) {
+        value = 180 - value;
+    }
+    int16_t sine = (int16_t) pgm_read_word(&dogmGraphic_sine[value]);
+    return negative ? -sine : sine;
+}
+
+int16_t dogmGraphic_cos(int16_t angle) {
+    return dogmGraphic_sin((int16_t) (dogmGraphic_angle(angle) + 90));
+}
+
+/*! @brief division rounded down for a positive divisor
+ */
+static int32_t dogmGraphic_divFloor(int32_t value, int16_t divisor) {
+    return (value >= 0) ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+/*! @brief the part of a circle between two rays from its middle
+ *
+ * The directions of the rays are in fixed point with the y axis upwards. A convex wedge of up to 180 degree is the
+ * common part of two half planes, the rest of the circle is the wedge between the end and the start.
+ */
+typedef struct {
+    int16_t start_x;
+    int16_t start_y;
+    int16_t end_x;
+    int16_t end_y;
+    enum {
+        DOGM_WEDGE_ALL,
+        DOGM_WEDGE_CONVEX,
+        DOGM_WEDGE_CONCAVE
+    } shape;
+} dogmGraphic_wedge_t;
+
+/*! @brief cut a column span to a half plane
+ *
+ * @param ux        direction of the border of the half plane
+ * @param uy        direction of the border of the half plane
+ * @param px        column relative to the middle
+ * @param least     0 keeps the border, 1 leaves it out
+ * @param low       lowest row of the span relative to the middle, upwards
+ * @param high      highest row of the span relative to the middle, upwards
+ *
+ * The rows py kept are the ones left of the direction, ux * py - uy * px >= least.
+ */
+static void dogmGraphic_halfPlane(int16_t ux, int16_t uy, int16_t px, uint8_t least, int16_t *low, int16_t *high) {
+    int32_t limit = (int32_t) uy * px + least;
+    if (ux > 0) {
+        int32_t bound = -dogmGraphic_divFloor(-limit, ux);
+        if (bound > *low) {
+            *low = (bound > *high) ? (int16_t) (*high + 1) : (int16_t) bound;
+        }
+    }
+    else if (ux < 0) {
+        int32_t bound = dogmGraphic_divFloor(-limit, (int16_t) -ux);
+        if (bound < *high) {
+            *high = (bound < *low) ? (int16_t) (*low - 1) : (int16_t) bound;
+        }
+    }
+    else if (limit > 0) {
+        *high = (int16_t) (*low - 1);
+    }
+}
+
+/*! @brief fill the part of a column span inside of a wedge
+ *
+ * @param wedge     wedge of the arc
+ * @param cx        horizontal middle position
+ * @param cy        vertical middle position
+ * @param px        column relative to the middle
+ * @param low       lowest row of the span relative to the middle, upwards
+ * @param high      highest row of the span relative to the middle, upwards
+ */
+static void dogmGraphic_wedgeSpan(const dogmGraphic_wedge_t *wedge, int16_t cx, int16_t cy, int16_t px, int16_t low,
+                                  int16_t high) {
+    int16_t from = low;
+    int16_t to = high;
+    if (wedge->shape == DOGM_WEDGE_CONVEX) {
+        dogmGraphic_halfPlane(wedge->start_x, wedge->start_y, px, 0, &from, &to);
+        dogmGraphic_halfPlane((int16_t) -wedge->end_x, (int16_t) -wedge->end_y, px, 0, &from, &to);
+    }
+    else if (wedge->shape == DOGM_WEDGE_CONCAVE) {
+        // the rows of the open wedge from the end to the start are left out
+        dogmGraphic_halfPlane(wedge->end_x, wedge->end_y, px, 1, &from, &to);
+        dogmGraphic_halfPlane((int16_t) -wedge->start_x, (int16_t) -wedge->start_y, px, 1, &from, &to);
+        if (from <= to) {
+            dogmGraphic_fillClipped(cx + px, cy - from + 1, cx + px, cy - low, DOGM_ADD);
+            dogmGraphic_fillClipped(cx + px, cy - high, cx + px, cy - to - 1, DOGM_ADD);
+            return;
+        }
+        from = low;
+        to = high;
+    }
+    if (from <= to) {
+        dogmGraphic_fillClipped(cx + px, cy - to, cx + px, cy - from, DOGM_ADD);
+    }
+}
+
+/*! @brief fill one column of a ring inside of a wedge
+ *
+ * @param wedge     wedge of the arc
+ * @param cx        horizontal middle position
+ * @param cy        vertical middle position
+ * @param px        column relative to the middle
+ * @param half      half height of the outer circle in the column
+ * @param hole      half height of the inner circle in the column, -1 without one
+ */
+static void dogmGraphic_arcColumn(const dogmGraphic_wedge_t *wedge, int16_t cx, int16_t cy, int16_t px, int16_t half,
+                                  int16_t hole) {
+    if (hole < 0) {
+        dogmGraphic_wedgeSpan(wedge, cx, cy, px, (int16_t) -half, half);
+    }
+    else {
+        dogmGraphic_wedgeSpan(wedge, cx, cy, px, (int16_t) (hole + 1), half);
+        dogmGraphic_wedgeSpan(wedge, cx, cy, px, (int16_t) -half, (int16_t) (-hole - 1));
+    }
+}
+
+void dogmGraphic_drawArc(uint8_t start_x, uint8_t start_y, uint8_t radius, int16_t start, int16_t end, uint8_t width) {
+    dogmGraphic_wedge_t wedge = {dogmGraphic_cos(start), dogmGraphic_sin(start), dogmGraphic_cos(end),
+                                 dogmGraphic_sin(end), DOGM_WEDGE_ALL};
+    int32_t sweep = (int32_t) end - start;
+    if (sweep < 360) {
+        sweep = dogmGraphic_angle(sweep);
+        if (!sweep) {
+            return;
+        }
+        wedge.shape = (sweep <= 180) ? DOGM_WEDGE_CONVEX : DOGM_WEDGE_CONCAVE;
+    }
+    if (!width) {
+        width = 1;
+    }
+
+    // the columns of the ring of dogmGraphic_drawCircleStroke, each one cut by the wedge
+    dogmGraphic_ellipseWalk_t outer;
+    dogmGraphic_ellipseWalk_t inner;
+    dogmGraphic_ellipseBegin(&outer, radius, radius);
+    int16_t half = radius;
+    int16_t hole = (int16_t) radius - width;
+    dogmGraphic_ellipseBegin(&inner, (hole < 0) ? 0 : (uint8_t) hole, (hole < 0) ? 0 : (uint8_t) hole);
+
+    for (int16_t dx = 0; dx <= radius; dx++) {
+        dogmGraphic_arcColumn(&wedge, start_x, start_y, dx, half, hole);
+        if (dx) {
+            dogmGraphic_arcColumn(&wedge, start_x, start_y, (int16_t) -dx, half, hole);
+        }
+        half = dogmGraphic_ellipseNext(&outer);
+        if (hole >= 0) {
+            hole = dogmGraphic_ellipseNext(&inner);
+        }
+    }
+}
+
+void dogmGraphic_drawPie(uint8_t start_x, uint8_t start_y, uint8_t radius, int16_t start, int16_t end) {
+    dogmGraphic_drawArc(start_x, start_y, radius, start, end, (uint8_t) (radius < 255 ? radius + 1 : radius));
+}
+
+void dogmGraphic_drawNeedle(uint8_t start_x, uint8_t start_y, uint8_t inner, uint8_t outer, int16_t angle,
+                            uint8_t width) {
+    int16_t cosine = dogmGraphic_cos(angle);
+    int16_t sine = dogmGraphic_sin(angle);
+    int16_t x0 = start_x + dogmGraphic_divRound((int32_t) cosine * inner, DOGM_TRIG_ONE);
+    int16_t y0 = start_y - dogmGraphic_divRound((int32_t) sine * inner, DOGM_TRIG_ONE);
+    int16_t x1 = start_x + dogmGraphic_divRound((int32_t) cosine * outer, DOGM_TRIG_ONE);
+    int16_t y1 = start_y - dogmGraphic_divRound((int32_t) sine * outer, DOGM_TRIG_ONE);
+    dogmGraphic_strokeLine(x0, y0, x1, y1, width);
+}
+
+/*! @brief draw a rectangle with rounded corners, filled or with a stroke width
+ *
+ * @param start_x       horizontal start position
+ * @param start_y       vertical start position
+ * @param deltaWidth    width
+ * @param deltaHeight   height
+ * @param radius        outer corner radius
+ * @param width         stroke width, 0 fills the rectangle
+ */
+static void dogmGraphic_roundedRectangle(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                                         uint8_t radius, uint8_t width) {
+    if (!deltaWidth || !deltaHeight) {
+        return;
+    }
+    uint8_t shorter = (deltaWidth < deltaHeight) ? deltaWidth : deltaHeight;
+    if (radius > ((shorter - 1) >> 1)) {
+        radius = (uint8_t) ((shorter - 1) >> 1);
+    }
+    // a stroke as wide as half of the rectangle fills it
+    if ((width << 1) >= shorter) {
+        width = 0;
+    }
+    int16_t x0 = start_x;
+    int16_t y0 = start_y;
+    int16_t x1 = (int16_t) (start_x + deltaWidth - 1);
+    int16_t y1 = (int16_t) (start_y + deltaHeight - 1);
+
+    // middles of the corner circles
+    int16_t left = x0 + radius;
+    int16_t right = x1 - radius;
+    int16_t top = y0 + radius;
+    int16_t bottom = y1 - radius;
+
+    // the columns between the corners, the hole is narrower than them for a stroke wider than the radius
+    if (!width) {
+        dogmGraphic_fillClipped(left, y0, right, y1, DOGM_ADD);
+    }
+    else {
+        int16_t hole_x0 = (x0 + width > left) ? x0 + width : left;
+        int16_t hole_x1 = (x1 - width < right) ? x1 - width : right;
+        dogmGraphic_fillClipped(left, y0, right, y0 + width - 1, DOGM_ADD);
+        dogmGraphic_fillClipped(left, y1 - width + 1, right, y1, DOGM_ADD);
+        dogmGraphic_fillClipped(left, y0 + width, hole_x0 - 1, y1 - width, DOGM_ADD);
+        dogmGraphic_fillClipped(hole_x1 + 1, y0 + width, right, y1 - width, DOGM_ADD);
+    }
+
+    // the corners, the inner corners share the middles with the outer ones
+    dogmGraphic_ellipseWalk_t outer;
+    dogmGraphic_ellipseWalk_t inner;
+    dogmGraphic_ellipseBegin(&outer, radius, radius);
+    uint8_t ring = width && (radius >= width);
+    dogmGraphic_ellipseBegin(&inner, ring ? radius - width : 0, ring ? radius - width : 0);
+
+    for (int16_t dx = 1; dx <= radius; dx++) {
+        int16_t half = dogmGraphic_ellipseNext(&outer);
+        int16_t hole = ring ? dogmGraphic_ellipseNext(&inner) : -1;
+        if (hole < 0) {
+            dogmGraphic_fillClipped(left - dx, top - half, left - dx, bottom + half, DOGM_ADD);
+            dogmGraphic_fillClipped(right + dx, top - half, right + dx, bottom + half, DOGM_ADD);
+        }
+        else {
+            dogmGraphic_fillClipped(left - dx, top - half, left - dx, top - hole - 1, DOGM_ADD);
+            dogmGraphic_fillClipped(left - dx, bottom + hole + 1, left - dx, bottom + half, DOGM_ADD);
+            dogmGraphic_fillClipped(right + dx, top - half, right + dx, top - hole - 1, DOGM_ADD);
+            dogmGraphic_fillClipped(right + dx, bottom + hole + 1, right + dx, bottom + half, DOGM_ADD);
+        }
+    }
+}
+
+void dogmGraphic_drawRoundedRectangle(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                                      uint8_t radius, uint8_t fill) {
+    dogmGraphic_roundedRectangle(start_x, start_y, deltaWidth, deltaHeight, radius, fill ? 0 : 1);
+}
+
+void dogmGraphic_drawRoundedRectangleStroke(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                                            uint8_t radius, uint8_t width) {
+    if (!width) {
+        return;
+    }
+    dogmGraphic_roundedRectangle(start_x, start_y, deltaWidth, deltaHeight, radius, width);
+}
+
+void dogmGraphic_drawP(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                       dogmGraphic_drawType_t type, const void *progMemSpace) {
+    const dogmGraphic_bitmap_t source = {progMemSpace, deltaWidth, deltaHeight, DOGM_MEMORY_PROGMEM, DOGM_BITMAP_RAW};
+    dogmGraphic_blit(start_x, start_y, &source, 0, 0, deltaWidth, deltaHeight, type);
+}
+
+void dogmGraphic_blit(uint8_t start_x, uint8_t start_y, const dogmGraphic_bitmap_t *source, uint8_t source_x,
+                      uint8_t source_y, uint8_t width, uint8_t height, dogmGraphic_drawType_t type) {
+    // proof of start point
+    if (!dogmGraphic_testHeight(start_y) || !dogmGraphic_testWidth(start_x)) {
+        logging_printString_P(LOG_WARNING, PSTR("Blit; Position out of range"));
+        return;
+    }
+    if (type > DOGM_SET) {
+        logging_printString_P(LOG_WARNING, PSTR("Blit; DrawType unknown"));
+        return;
+    }
+
+    // the copied part has to be inside of the bitmap
+    if ((source_x >= source->width) || (source_y >= source->height)) {
+        return;
+    }
+    if (width > (source->width - source_x)) {
+        width = source->width - source_x;
+    }
+    if (height > (source->height - source_y)) {
+        height = source->height - source_y;
+    }
+
+    // visible part
+    const clipRect_t *clip = &dogmGraphic_clip;
+    int16_t x0 = (start_x < clip->x0) ? clip->x0 : start_x;
+    int16_t y0 = (start_y < clip->y0) ? clip->y0 : start_y;
+    int16_t x1 = (int16_t) start_x + width - 1;
+    int16_t y1 = (int16_t) start_y + height - 1;
+    if (x1 > clip->x1) {
+        x1 = clip->x1;
+    }
+    if (y1 > clip->y1) {
+        y1 = clip->y1;
+    }
+    if ((x0 > x1) || (y0 > y1)) {
+        return;
+    }
+
+    // first visible bitmap column and the ram row of bitmap row 0
+    uint8_t column = (uint8_t) (source_x + (x0 - start_x));
+    uint8_t row = dogmGraphic_row((uint8_t) y0);
+    int16_t origin = (int16_t) row - (source_y + (y0 - start_y));
+
+#if DOGM_SPRITE_CACHE_ENTRIES
+    // a cached flash bitmap is already moved to the bit of its first row, so it is copied page aligned
+    dogmGraphic_bitmap_t cached;
+    if ((source->memory == DOGM_MEMORY_PROGMEM) && (source->format == DOGM_BITMAP_RAW)) {
+        uint8_t shift = (uint8_t) (origin & 0x07); // modulo 8, also for negative rows
+        const uint8_t *bytes = dogmGraphic_cacheGet(source, shift);
+        if (bytes != NULL) {
+            cached = (dogmGraphic_bitmap_t) {bytes, source->width, (uint8_t) (source->height + shift),
+                                             DOGM_MEMORY_RAM, DOGM_BITMAP_RAW};
+            origin -= shift;
+            source = &cached;
+        }
+    }
+#endif
+
+    // the visible rows may wrap around the end of the ram
+    uint8_t rows = (uint8_t) (y1 - y0 + 1);
+    uint8_t first = dogmGraphic_rowsToEnd(row);
+    if (rows <= first) {
+        dogmGraphic_blitRows(source, column, origin, (uint8_t) x0, (uint8_t) x1, row, row + rows - 1, type);
+    }
+    else {
+        dogmGraphic_blitRows(source, column, origin, (uint8_t) x0, (uint8_t) x1, row, DOGM_DISPLAY_HEIGHT - 1, type);
+        dogmGraphic_blitRows(source, column, origin - DOGM_DISPLAY_HEIGHT, (uint8_t) x0, (uint8_t) x1, 0,
+                             rows - first - 1, type);
+    }
+}
+
+/*! @brief read one bitmap byte
+ */
+static inline uint8_t dogmGraphic_readBitmap(const dogmGraphic_bitmap_t *source, const uint8_t *data) {
+    return (source->memory == DOGM_MEMORY_PROGMEM) ? pgm_read_byte(data) : *data;
+}
+
+/*! @brief write one bitmap byte into the ram
+ *
+ * @param ram       byte of the render target
+ * @param content   bitmap byte moved to the rows of the ram byte
+ * @param mask      visible rows of the ram byte
+ * @param type      drawing type
+ */
+static inline void dogmGraphic_blitByte(uint8_t *ram, uint8_t content, uint8_t mask, dogmGraphic_drawType_t type) {
+    switch (type) {
+        case DOGM_ADD:
+            *ram |= (content & mask);
+            break;
+        case DOGM_CLEAR:
+            *ram &= (uint8_t) ~(content & mask);
+            break;
+        case DOGM_INVERT:
+            content = ~content;
+            // no break, set inverted bitmap
+        default:
+            *ram = (*ram & (uint8_t) ~mask) | (content & mask);
+    }
+}
+
+/*! @brief blit visible bitmap columns into ram rows
+ *
+ * @param source    bitmap
+ * @param column    first visible column of the bitmap
+ * @param origin    ram row of bitmap row 0, may be outside of the ram
+ * @param x0        first visible column
+ * @param x1        last visible column
+ * @param firstRow  first visible ram row
+ * @param lastRow   last visible ram row, the rows do not wrap around the end of the ram
+ * @param type      drawing type
+ */
+static void dogmGraphic_blitRows(const dogmGraphic_bitmap_t *source, uint8_t column, int16_t origin, uint8_t x0,
+                                 uint8_t x1, uint8_t firstRow, uint8_t lastRow, dogmGraphic_drawType_t type) {
+    if (source->format == DOGM_BITMAP_RLE) {
+        dogmGraphic_blitRowsRle(source, column, origin, x0, x1, firstRow, lastRow, type);
+        return;
+    }
+    const uint8_t *data = (const uint8_t *) source->data + column;
+    int8_t sourcePages = (int8_t) ((source->height + 7) >> 3); // divide by 8
+    uint8_t firstPage = firstRow >> 3; // divide by 8
+    uint8_t lastPage = lastRow >> 3; // divide by 8
+    uint8_t firstMask = dogmGraphic_maskFrom[firstRow & 0x07];
+    uint8_t lastMask = dogmGraphic_maskTo[lastRow & 0x07];
+
+    // bitmap row in bit 0 of the first page, each page gets the high byte of one and the low byte of the next product
+    int16_t sourceRow = (int16_t) (firstPage << 3) - origin;
+    uint8_t shift = (uint8_t) (sourceRow & 0x07); // modulo 8, also for negative rows
+    int8_t sourcePage = (int8_t) ((sourceRow - shift) / 8);
+    uint16_t factor = (uint16_t) (1 << (8 - shift));
+    if (!shift) {
+        // page aligned, e.g. a cached sprite, every page is a masked byte copy without carry
+        sourcePage--;
+    }
+
+    for (uint8_t x = x0;; x++) {
+        int8_t page = sourcePage;
+        int16_t offset = (int16_t) page * source->width;
+        uint8_t carry = 0;
+        if (shift && (page >= 0) && (page < sourcePages)) {
+            carry = (uint8_t) ((dogmGraphic_readBitmap(source, data + offset) * factor) >> 8);
+        }
+
+        for (uint8_t p = firstPage; p <= lastPage; p++) {
+            page++;
+            offset += source->width;
+            uint8_t value = ((page >= 0) && (page < sourcePages)) ? dogmGraphic_readBitmap(source, data + offset) : 0;
+            uint8_t content = value;
+            if (shift) {
+                uint16_t product = value * factor;
+                content = carry | (uint8_t) product;
+                carry = (uint8_t) (product >> 8);
+            }
+
+            uint8_t mask = 0xFF;
+            if (p == firstPage) {
+                mask &= firstMask;
+            }
+            if (p == lastPage) {
+                mask &= lastMask;
+            }
+            dogmGraphic_blitByte(dogmGraphic_page(p) + x, content, mask, type);
+        }
+        data++;
+        if (x == x1) {
+            break;
+        }
+    }
+
+    for (uint8_t p = firstPage; p <= lastPage; p++) {
+        dogmGraphic_markColumns(p, x0, x1);
+    }
+}
+
+/*! @brief position of the decoder in a run length encoded bitmap
+ *
+ * @param data      next code or literal byte
+ * @param memory    memory of the data
+ * @param kind      kind of the actual run, the two high bits of its code
+ * @param count     bytes left in the actual run
+ * @param value     byte of a run of one value
+ */
+typedef struct {
+    const uint8_t *data;
+    dogmGraphic_memory_t memory;
+    uint8_t kind;
+    uint8_t count;
+    uint8_t value;
+} dogmGraphic_rle_t;
+
+/*! @brief read one byte of the encoded data
+ */
+static inline uint8_t dogmGraphic_rleRead(dogmGraphic_rle_t *rle) {
+    uint8_t value = (rle->memory == DOGM_MEMORY_PROGMEM) ? pgm_read_byte(rle->data) : *rle->data;
+    rle->data++;
+    return value;
+}
+
+/*! @brief start the next run
+ */
+static void dogmGraphic_rleLoad(dogmGraphic_rle_t *rle) {
+    uint8_t code = dogmGraphic_rleRead(rle);
+    rle->kind = code & DOGM_RLE_REPEAT;
+    rle->count = (uint8_t) ((code & DOGM_RLE_COUNT) + 1);
+    switch (rle->kind) {
+        case DOGM_RLE_ZEROS:
+            rle->value = 0x00;
+            break;
+        case DOGM_RLE_ONES:
+            rle->value = 0xFF;
+            break;
+        case DOGM_RLE_REPEAT:
+            rle->value = dogmGraphic_rleRead(rle);
+            break;
+        default:
+            break;
+    }
+}
+
+/*! @brief decode the next byte
+ */
+static inline uint8_t dogmGraphic_rleNext(dogmGraphic_rle_t *rle) {
+    if (!rle->count) {
+        dogmGraphic_rleLoad(rle);
+    }
+    rle->count--;
+    return (rle->kind == DOGM_RLE_LITERAL) ? dogmGraphic_rleRead(rle) : rle->value;
+}
+
+/*! @brief pass over decoded bytes
+ *
+ * @param rle       decoder
+ * @param bytes     number of bytes, whole runs are passed at once
+ */
+static void dogmGraphic_rleSkip(dogmGraphic_rle_t *rle, uint16_t bytes) {
+    while (bytes) {
+        if (!rle->count) {
+            dogmGraphic_rleLoad(rle);
+        }
+        uint8_t step = (bytes < rle->count) ? (uint8_t) bytes : rle->count;
+        rle->count -= step;
+        bytes -= step;
+        if (rle->kind == DOGM_RLE_LITERAL) {
+            rle->data += step;
+        }
+    }
+}
+
+/*! @brief blit visible columns of a run length encoded bitmap into ram rows
+ *
+ * @see dogmGraphic_blitRows
+ *
+ * The encoded pages can only be read from the start, so the ram is written page by page. Every ram page needs the
+ * bitmap page with its low rows and, for a shifted bitmap, the one above for the carry. The decoder at the start of a
+ * page is only a few bytes, it is copied for both of them, so there is no buffer for decoded bytes.
+ */
+static void dogmGraphic_blitRowsRle(const dogmGraphic_bitmap_t *source, uint8_t column, int16_t origin, uint8_t x0,
+                                    uint8_t x1, uint8_t firstRow, uint8_t lastRow, dogmGraphic_drawType_t type) {
+    int8_t sourcePages = (int8_t) ((source->height + 7) >> 3); // divide by 8
+    uint8_t firstPage = firstRow >> 3; // divide by 8
+    uint8_t lastPage = lastRow >> 3; // divide by 8
+
+    int16_t sourceRow = (int16_t) (firstPage << 3) - origin;
+    uint8_t shift = (uint8_t) (sourceRow & 0x07); // modulo 8, also for negative rows
+    int8_t page = (int8_t) ((sourceRow - shift) / 8);
+    uint16_t factor = (uint16_t) (1 << (8 - shift));
+    if (!shift) {
+        page--;
+    }
+
+    // decoder at the start of the page above the low rows
+    dogmGraphic_rle_t upper = {(const uint8_t *) source->data, source->memory, DOGM_RLE_LITERAL, 0, 0};
+    if (page > 0) {
+        dogmGraphic_rleSkip(&upper, (uint16_t) page * source->width);
+    }
+
+    for (uint8_t p = firstPage; p <= lastPage; p++) {
+        dogmGraphic_rle_t lower = upper;
+        if ((page >= 0) && (page + 1 < sourcePages)) {
+            dogmGraphic_rleSkip(&lower, source->width);
+        }
+        dogmGraphic_rle_t high = upper;
+        dogmGraphic_rle_t low = lower;
+        uint8_t hasHigh = shift && (page >= 0) && (page < sourcePages);
+        uint8_t hasLow = (page + 1 >= 0) && (page + 1 < sourcePages);
+        if (hasHigh) {
+            dogmGraphic_rleSkip(&high, column);
+        }
+        if (hasLow) {
+            dogmGraphic_rleSkip(&low, column);
+        }
+
+        uint8_t mask = 0xFF;
+        if (p == firstPage) {
+            mask &= dogmGraphic_maskFrom[firstRow & 0x07];
+        }
+        if (p == lastPage) {
+            mask &= dogmGraphic_maskTo[lastRow & 0x07];
+        }
+        uint8_t *ram = dogmGraphic_page(p) + x0;
+        for (uint8_t x = x0;; x++) {
+            uint8_t content = hasLow ? dogmGraphic_rleNext(&low) : 0;
+            if (shift) {
+                uint8_t carry = hasHigh ? (uint8_t) ((dogmGraphic_rleNext(&high) * factor) >> 8) : 0;
+                content = carry | (uint8_t) (content * factor);
+            }
+            dogmGraphic_blitByte(ram++, content, mask, type);
+            if (x == x1) {
+                break;
+            }
+        }
+        dogmGraphic_markColumns(p, x0, x1);
+        upper = lower;
+        page++;
+    }
+}
+
+#if DOGM_SPRITE_CACHE_ENTRIES
+/*! @brief pre-shifted copy of a flash bitmap
+ *
+ * @param data      flash data of the bitmap, NULL for an empty entry
+ * @param width     width of the bitmap
+ * @param height    height of the bitmap
+ * @param shift     bit of page 0, where bitmap row 0 is stored
+ * @param age       number of cache accesses since the last use
+ * @param bytes     bitmap moved down by shift rows, page organized
+ */
+static struct {
+    const void *data;
+    uint8_t width;
+    uint8_t height;
+    uint8_t shift;
+    uint8_t age;
+    uint8_t bytes[DOGM_SPRITE_CACHE_BYTES];
+} dogmGraphic_cache[DOGM_SPRITE_CACHE_ENTRIES];
+
+static uint16_t dogmGraphic_cacheHits = 0;
+static uint16_t dogmGraphic_cacheMisses = 0;
+
+/*! @brief get the pre-shifted copy of a flash bitmap
+ *
+ * @param source    flash bitmap
+ * @param shift     bit of page 0, where bitmap row 0 is stored
+ * @return          page organized copy, NULL if it is too large for an entry
+ *
+ * A miss replaces the least recently used entry.
+ */
+static const uint8_t *dogmGraphic_cacheGet(const dogmGraphic_bitmap_t *source, uint8_t shift) {
+    uint8_t found = 0xFF;
+    uint8_t oldest = 0;
+    for (uint8_t i = 0; i < DOGM_SPRITE_CACHE_ENTRIES; i++) {
+        if ((dogmGraphic_cache[i].data == source->data) && (dogmGraphic_cache[i].shift == shift) &&
+            (dogmGraphic_cache[i].width == source->width) && (dogmGraphic_cache[i].height == source->height)) {
+            found = i;
+        }
+        if (dogmGraphic_cache[i].age < 0xFF) {
+            dogmGraphic_cache[i].age++;
+        }
+        if ((dogmGraphic_cache[oldest].data != NULL) &&
+            ((dogmGraphic_cache[i].data == NULL) || (dogmGraphic_cache[i].age > dogmGraphic_cache[oldest].age))) {
+            oldest = i;
+        }
+    }
+    if (found != 0xFF) {
+        dogmGraphic_cacheHits++;
+        dogmGraphic_cache[found].age = 0;
+        return dogmGraphic_cache[found].bytes;
+    }
+
+    dogmGraphic_cacheMisses++;
+    uint8_t sourcePages = (source->height + 7) >> 3; // divide by 8
+    uint8_t pages = (uint8_t) ((source->height + shift + 7) >> 3); // divide by 8
+    if (((uint16_t) pages * source->width) > DOGM_SPRITE_CACHE_BYTES) {
+        return NULL;
+    }
+
+    // bitmap row 0 moves to bit shift of page 0, the bits shifted out of a page move into the next one
+    uint8_t *bytes = dogmGraphic_cache[oldest].bytes;
+    const uint8_t *data = (const uint8_t *) source->data;
+    for (uint8_t page = 0; page < pages; page++) {
+        for (uint8_t x = 0; x < source->width; x++) {
+            uint8_t value = 0;
+            if (page < sourcePages) {
+                value = (uint8_t) (pgm_read_byte(data + page * source->width + x) << shift);
+            }
+            if (shift && page) {
+                value |= (uint8_t) (pgm_read_byte(data + (page - 1) * source->width + x) >> (8 - shift));
+            }
+            *bytes++ = value;
+        }
+    }
+    dogmGraphic_cache[oldest].data = source->data;
+    dogmGraphic_cache[oldest].width = source->width;
+    dogmGraphic_cache[oldest].height = source->height;
+    dogmGraphic_cache[oldest].shift = shift;
+    dogmGraphic_cache[oldest].age = 0;
+    return dogmGraphic_cache[oldest].bytes;
+}
+#endif
+
+void dogmGraphic_clearCache(void) {
+#if DOGM_SPRITE_CACHE_ENTRIES
+    for (uint8_t i = 0; i < DOGM_SPRITE_CACHE_ENTRIES; i++) {
+        dogmGraphic_cache[i].data = NULL;
+        dogmGraphic_cache[i].age = 0;
+    }
+    dogmGraphic_cacheHits = 0;
+    dogmGraphic_cacheMisses = 0;
+#endif
+}
+
+uint16_t dogmGraphic_getCacheHits(void) {
+#if DOGM_SPRITE_CACHE_ENTRIES
+    return dogmGraphic_cacheHits;
+#else
+    return 0;
+#endif
+}
+
+uint16_t dogmGraphic_getCacheMisses(void) {
+#if DOGM_SPRITE_CACHE_ENTRIES
+    return dogmGraphic_cacheMisses;
+#else
+    return 0;
+#endif
+}
+
+/*! @brief take memory from the arena
+ *
+ * @param bytes     size
+ * @return          memory, NULL if the arena is full or there is no arena
+ */
+static uint8_t *dogmGraphic_arenaTake(uint16_t bytes) {
+#if DOGM_CANVAS_ARENA_BYTES
+    if (bytes > (DOGM_CANVAS_ARENA_BYTES - dogmGraphic_arenaUsed)) {
+        logging_printString_P(LOG_WARNING, PSTR("Arena; full"));
+        return NULL;
+    }
+    uint8_t *memory = &dogmGraphic_arena[dogmGraphic_arenaUsed];
+    dogmGraphic_arenaUsed += bytes;
+    return memory;
+#else
+    logging_printString_P(LOG_WARNING, PSTR("Arena; not available"));
+    return NULL;
+#endif
+}
+
+/*! @brief give memory back to the arena
+ *
+ * @param memory    memory taken at last
+ * @param bytes     size
+ *
+ * Only the memory taken at last can be given back, e.g. of nested popups closed in reverse order.
+ */
+static void dogmGraphic_arenaGiveBack(uint8_t *memory, uint16_t bytes) {
+#if DOGM_CANVAS_ARENA_BYTES
+    if ((memory + bytes) == &dogmGraphic_arena[dogmGraphic_arenaUsed]) {
+        dogmGraphic_arenaUsed -= bytes;
+    }
+#endif
+}
+
+uint8_t dogmGraphic_createCanvas(dogmCanvas_t *canvas, uint8_t width, uint8_t height) {
+    if (!width || !height || (width > DOGM_DISPLAY_WIDTH) || (height > DOGM_DISPLAY_HEIGHT)) {
+        logging_printString_P(LOG_WARNING, PSTR("Canvas; Size out of range"));
+        return 0;
+    }
+    uint16_t bytes = (uint16_t) width * ((height + 7) >> 3); // divide by 8
+    canvas->buffer = dogmGraphic_arenaTake(bytes);
+    if (canvas->buffer == NULL) {
+        return 0;
+    }
+    canvas->width = width;
+    canvas->height = height;
+    canvas->clip = (clipRect_t) {0, 0, width - 1, height - 1};
+    memset(canvas->buffer, 0x00, bytes);
+    return 1;
+}
+
+void dogmGraphic_releaseCanvases(void) {
+    dogmGraphic_canvas = NULL;
+#if DOGM_CANVAS_ARENA_BYTES
+    dogmGraphic_arenaUsed = 0;
+#endif
+}
+
+void dogmGraphic_drawToCanvas(dogmCanvas_t *canvas) {
+    dogmGraphic_canvas = canvas;
+}
+
+void dogmGraphic_clearCanvas(dogmCanvas_t *canvas) {
+    memset(canvas->buffer, 0x00, (size_t) canvas->width * ((canvas->height + 7) >> 3)); // divide by 8
+}
+
+void dogmGraphic_blitCanvas(uint8_t start_x, uint8_t start_y, const dogmCanvas_t *canvas,
+                            dogmGraphic_drawType_t type) {
+    if (canvas == dogmGraphic_canvas) {
+        logging_printString_P(LOG_WARNING, PSTR("Canvas; Blit into itself"));
+        return;
+    }
+    const dogmGraphic_bitmap_t source = {canvas->buffer, canvas->width, canvas->height, DOGM_MEMORY_RAM,
+                                         DOGM_BITMAP_RAW};
+    dogmGraphic_blit(start_x, start_y, &source, 0, 0, canvas->width, canvas->height, type);
+}
+
+uint8_t dogmGraphic_saveUnder(dogmSaveUnder_t *save, uint8_t *buffer, uint8_t x, uint8_t y, uint8_t width,
+                              uint8_t height) {
+    uint8_t targetWidth = (dogmGraphic_canvas != NULL) ? dogmGraphic_canvas->width : DOGM_DISPLAY_WIDTH;
+    uint8_t targetHeight = (dogmGraphic_canvas != NULL) ? dogmGraphic_canvas->height : DOGM_DISPLAY_HEIGHT;
+    if ((x >= targetWidth) || (y >= targetHeight) || !width || !height) {
+        logging_printString_P(LOG_WARNING, PSTR("Save Under; Position out of range"));
+        return 0;
+    }
+    if (width > (targetWidth - x)) {
+        width = targetWidth - x;
+    }
+    if (height > (targetHeight - y)) {
+        height = targetHeight - y;
+    }
+
+    // whole pages of the ram rows, a scrolled rectangle may wrap around the end of the ram
+    uint8_t row = dogmGraphic_row(y);
+    uint8_t pages = (uint8_t) (((row & 0x07) + height + 7) >> 3); // divide by 8
+    save->arena = (buffer == NULL);
+    if (save->arena) {
+        buffer = dogmGraphic_arenaTake((uint16_t) width * pages);
+        if (buffer == NULL) {
+            return 0;
+        }
+    }
+    save->buffer = buffer;
+    save->x = x;
+    save->row = row;
+    save->width = width;
+    save->height = height;
+
+    for (uint8_t k = 0; k < pages; k++) {
+        memcpy(buffer, dogmGraphic_page(((row >> 3) + k) & (DOGM_DISPLAY_PAGES - 1)) + x, width);
+        buffer += width;
+    }
+    return 1;
+}
+
+void dogmGraphic_restoreUnder(dogmSaveUnder_t *save) {
+    if (save->buffer == NULL) {
+        return;
+    }
+    uint8_t row = save->row;
+    uint8_t lastRow = (uint8_t) (row + save->height - 1);
+    uint8_t pages = (uint8_t) (((row & 0x07) + save->height + 7) >> 3); // divide by 8
+    const uint8_t *buffer = save->buffer;
+
+    for (uint8_t k = 0; k < pages; k++) {
+        uint8_t page = ((row >> 3) + k) & (DOGM_DISPLAY_PAGES - 1);
+        uint8_t *column = dogmGraphic_page(page) + save->x;
+
+        // rows of the first and last page outside of the rectangle keep what was drawn meanwhile
+        uint8_t mask = 0xFF;
+        if (!k) {
+            mask &= dogmGraphic_maskFrom[row & 0x07];
+        }
+        if (k == (pages - 1)) {
+            mask &= dogmGraphic_maskTo[lastRow & 0x07];
+        }
+        if (mask == 0xFF) {
+            memcpy(column, buffer, save->width);
+        }
+        else {
+            for (uint8_t i = 0; i < save->width; i++) {
+                column[i] = (column[i] & (uint8_t) ~mask) | (buffer[i] & mask);
+            }
+        }
+        dogmGraphic_markColumns(page, save->x, save->x + save->width - 1);
+        buffer += save->width;
+    }
+
+    if (save->arena) {
+        dogmGraphic_arenaGiveBack(save->buffer, (uint16_t) save->width * pages);
+    }
+    save->buffer = NULL;
+}
+
+#if DOGM_GRAY_PLANES
+void dogmGraphic_grayStart(void) {
+    dogmGraphic_grayStop();
+    dogmGraphic_flushRam(NULL);
+    dogmGraphic_display->grayFrame = 0;
+    dogmGraphic_display->grayShown = DOGM_GRAY_PLANES - 1;
+    dogmGraphic_grayDisplay = dogmGraphic_display;
+}
+
+void dogmGraphic_grayStop(void) {
+    dogmDisplay_t *display = dogmGraphic_grayDisplay;
+    if (display == NULL) {
+        return;
+    }
+    dogmGraphic_grayDisplay = NULL;
+
+    // the gray columns may still show a lower bit-plane
+    for (uint8_t page = 0; page < DOGM_DISPLAY_PAGES; page++) {
+        if (display->grayPages & (1 << page)) {
+            dogmGraphic_mergeColumns(display->newColumns, &display->newContent.value, page,
+                                     display->grayColumns[page].start, display->grayColumns[page].end);
+        }
+    }
+}
+
+/*! @brief send columns of a bit-plane
+ *
+ * @param display   display of the bit-plane, its pins have to be actual
+ * @param plane     first byte of the page in the bit-plane
+ * @param page      vertical page
+ * @param start     first column
+ * @param end       last column
+ *
+ * With DOGM_USE_SHADOW_RAM the sent bytes are copied to the shadow, so it always holds what the panel shows, also a
+ * lower bit-plane. The first flush after dogmGraphic_grayStop diffs against that.
+ */
+static void dogmGraphic_sendPlane(dogmDisplay_t *display, const uint8_t *plane, uint8_t page, uint8_t start,
+                                  uint8_t end) {
+    const uint8_t address[] = {
+            DOGM_PAGE_ADDR_CMD(page),
+            DOGM_COLUMN_ADDR_CMD_HIGH(start),
+            DOGM_COLUMN_ADDR_CMD_LOW(start)
+    };
+
+    dogm_beginTransfer();
+    dogm_cmdBurst(address, sizeof(address));
+#if DOGM_USE_SHADOW_RAM
+    dogm_dataBurstCopy(&plane[start], &display->shadow[page][start], (uint8_t) (end - start + 1));
+#else
+    (void) display;
+    dogm_dataBurst(&plane[start], (uint8_t) (end - start + 1));
+#endif
+    dogm_endTransfer();
+}
+
+uint8_t dogmGraphic_grayTick(void) {
+    dogmDisplay_t *display = dogmGraphic_grayDisplay;
+    if ((display == NULL) || (dogmGraphic_flushCursor.state != DOGM_FLUSH_IDLE)) {
+        return 0;
+    }
+
+    // the bit-plane of the frame is the number of trailing zeros counted from the top
+    uint8_t frame = (display->grayFrame >= DOGM_GRAY_FRAMES) ? 1 : (uint8_t) (display->grayFrame + 1);
+    display->grayFrame = frame;
+    uint8_t plane = DOGM_GRAY_PLANES - 1;
+    while (!(frame & 0x01)) {
+        frame >>= 1;
+        plane--;
+    }
+
+    // only display_content is shown twice in a row, its changes are in newContent; the main loop may widen the spans
+    // meanwhile, so they are taken like by a flush
+    uint8_t changed;
+    uint8_t startLine = DOGM_FLUSH_NO_START_LINE;
+    newColumns_t columns[DOGM_DISPLAY_PAGES];
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        changed = display->newContent.value;
+        if ((plane != display->grayShown) || changed || display->startLinePending) {
+            memcpy(columns, display->newColumns, sizeof(columns));
+            display->newContent.value = 0;
+            if (display->startLinePending) {
+                display->startLinePending = 0;
+                startLine = display->scrollOffset;
+            }
+        }
+    }
+    if ((plane == display->grayShown) && !changed && (startLine == DOGM_FLUSH_NO_START_LINE)) {
+        return 0;
+    }
+
+    const dogm_pins_t *pins = dogm_pins;
+    dogm_pins = &display->pins;
+    for (uint8_t page = 0; page < DOGM_DISPLAY_PAGES; page++) {
+        uint8_t pageMask = (uint8_t) (1 << page);
+        if (changed & pageMask) {
+            dogmGraphic_sendPlane(display, display->content[page], page, columns[page].start, columns[page].end);
+        }
+        if ((display->grayPages & pageMask) && ((plane != display->grayShown) || (changed & pageMask))) {
+            const uint8_t *data = (plane < (DOGM_GRAY_PLANES - 1)) ? display->gray[plane][page] : display->content[page];
+            dogmGraphic_sendPlane(display, data, page, display->grayColumns[page].start,
+                                  display->grayColumns[page].end);
+        }
+    }
+    display->grayShown = plane;
+    dogm_pins = pins;
+
+    if (startLine != DOGM_FLUSH_NO_START_LINE) {
+        dogmGraphic_sendStartLine(display, startLine);
+    }
+    return 1;
+}
+
+void dogmGraphic_drawToPlane(uint8_t plane) {
+    if (plane >= DOGM_GRAY_PLANES) {
+        logging_printString_P(LOG_WARNING, PSTR("Gray; Plane out of range"));
+        return;
+    }
+    dogmGraphic_plane = plane;
+}
+
+void dogmGraphic_clearGray(void) {
+    memset(dogmGraphic_display->gray, 0x00, sizeof(dogmGraphic_display->gray));
+    for (uint8_t page = 0; page < DOGM_DISPLAY_PAGES; page++) {
+        if (dogmGraphic_display->grayPages & (1 << page)) {
+            dogmGraphic_setNewContentColumns(page, dogmGraphic_display->grayColumns[page].start,
+                                             dogmGraphic_display->grayColumns[page].end);
+        }
+    }
+    dogmGraphic_display->grayPages = 0;
+}
+
+void dogmGraphic_drawGrayArea(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                              uint8_t level) {
+    if (level >= DOGM_GRAY_LEVELS) {
+        logging_printString_P(LOG_WARNING, PSTR("Gray; Level out of range"));
+        return;
+    }
+    uint8_t plane = dogmGraphic_plane;
+    for (dogmGraphic_plane = 0; dogmGraphic_plane < DOGM_GRAY_PLANES; dogmGraphic_plane++) {
+        dogmGraphic_drawArea(start_x, start_y, deltaWidth, deltaHeight,
+                             ((level >> dogmGraphic_plane) & 0x01) ? DOGM_ADD : DOGM_CLEAR);
+    }
+    dogmGraphic_plane = plane;
+}
+
+void dogmGraphic_drawGrayPolygon(const coordinatePoint_t *points, uint8_t count, uint8_t level) {
+    if (level >= DOGM_GRAY_LEVELS) {
+        logging_printString_P(LOG_WARNING, PSTR("Gray; Level out of range"));
+        return;
+    }
+    uint8_t plane = dogmGraphic_plane;
+    for (dogmGraphic_plane = 0; dogmGraphic_plane < DOGM_GRAY_PLANES; dogmGraphic_plane++) {
+        dogmGraphic_drawPolygon(points, count, ((level >> dogmGraphic_plane) & 0x01) ? DOGM_ADD : DOGM_CLEAR);
+    }
+    dogmGraphic_plane = plane;
+}
+#endif
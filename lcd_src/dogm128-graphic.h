@@ -38,9 +38,58 @@
 #define MCU_DOGM_GRAPHIC_H
 
 #include <stdint.h>
-#include <avr/pgmspace.h>
+#include "../sys_src/platform.h"
 
 #include "dogm128.h"
+#include "drawing/drawingUtilities.h"
+
+/*! @brief use a shadow copy of the display controller ram
+ *
+ * 1 = every flush compares the ram copy with the bytes sent at last and only sends the runs, which really differ.
+ * Redrawing the same content does not cost any transfer then. The shadow copy needs another
+ * DOGM_DISPLAY_PAGES * DOGM_DISPLAY_WIDTH bytes of ram.
+ * 0 = every changed column span is sent completely.
+ */
+#ifndef DOGM_USE_SHADOW_RAM
+#define DOGM_USE_SHADOW_RAM     0
+#endif
+
+/*! @brief number of pre-shifted flash bitmaps kept in ram
+ *
+ * Icons and glyphs are mostly drawn again and again at the same vertical bit offset. With a value above 0 the blitter
+ * keeps the last used flash bitmaps already shifted to that offset, a hit draws them with masked byte copies. Every
+ * entry needs DOGM_SPRITE_CACHE_BYTES plus 6 bytes of ram on the AVR, a flash pointer and four bytes of bookkeeping.
+ * 0 = no cache.
+ */
+#ifndef DOGM_SPRITE_CACHE_ENTRIES
+#define DOGM_SPRITE_CACHE_ENTRIES   0
+#endif
+
+/*! @brief bytes of the static arena for offscreen canvases
+ *
+ * A canvas of width x height pixels needs width * pages bytes of the arena. 0 = no canvases.
+ */
+#ifndef DOGM_CANVAS_ARENA_BYTES
+#define DOGM_CANVAS_ARENA_BYTES     0
+#endif
+
+/*! @brief maximal size of one cached bitmap
+ *
+ * A bitmap needs width * pages bytes with one more page, if its rows cross a page border. Larger bitmaps are not cached.
+ */
+#ifndef DOGM_SPRITE_CACHE_BYTES
+#define DOGM_SPRITE_CACHE_BYTES     48
+#endif
+
+/*! @brief number of bit-planes of the grayscale mode
+ *
+ * 2 or 3 = every display gets DOGM_GRAY_PLANES - 1 more ram copies beside display_content, together they store one of
+ * DOGM_GRAY_LEVELS gray levels per pixel. Every plane needs another DOGM_DISPLAY_PAGES * DOGM_DISPLAY_WIDTH bytes of
+ * ram. 0 = monochrome only.
+ */
+#ifndef DOGM_GRAY_PLANES
+#define DOGM_GRAY_PLANES            0
+#endif
 
 /*! @brief actual display copy in ram
  *
@@ -50,8 +99,11 @@
  * bytes, so that for example a height of 64 pixel is stored in 8 bytes, because every byte represents in vertical
  * direction 8 pixel. Therefore it is necessary to implement a transformation between width[px]/height[pages] to x/y.
  * This transformation will be done on the higher layers.
+ *
+ * After dogmGraphic_scroll, the logical row y is stored in the row (y + dogmGraphic_getScrollOffset()) modulo 64.
+ * The array belongs to the display bound with dogmGraphic_bind.
  */
-uint8_t display_content[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+#define display_content             (dogmGraphic_display->content)
 
 /*! @brief information about needed refresh pages
  *
@@ -74,29 +126,150 @@ typedef union {
     } pages;
 } newContent_t;
 
-newContent_t dogmGraphic_newContent;
+#define dogmGraphic_newContent      (dogmGraphic_display->newContent)
+
+/*! @brief information about needed refresh columns
+ *
+ * @param start     first changed column in page
+ * @param end       last changed column in page
+ *
+ * This struct contains the changed horizontal span of one vertical page. The span is only valid, if the bit of the
+ * page is set in the newContent union. The flush only sends the columns from start to end, so a single changed dot
+ * costs one data byte instead of the whole page.
+ */
+typedef struct {
+    uint8_t start;
+    uint8_t end;
+} newColumns_t;
+
+#define dogmGraphic_newColumns      (dogmGraphic_display->newColumns)
 
 /*! @brief set newContent flags
  *
  * @param page      new content in this page
  *
- * This internal functions sets the specific bit with the given number in the newContent struct.
+ * This internal functions sets the specific bit with the given number in the newContent struct. The complete page
+ * width will be refreshed.
  */
 void dogmGraphic_setNewContent(uint8_t page);
 
+/*! @brief set newContent flags for a column span
+ *
+ * @param page      new content in this page
+ * @param start     first changed column
+ * @param end       last changed column
+ *
+ * This internal function sets the specific bit with the given number in the newContent struct and widens the column
+ * span of the page, so that it contains the given columns too.
+ */
+void dogmGraphic_setNewContentColumns(uint8_t page, uint8_t start, uint8_t end);
+
 /*! @brief actual low level cursor in ram
  *
  * This struct represents on a very low layer the actual position on the ram copy. With this struct it is a little bit
  * more easy to iterate about the horizontal or the vertical position in bytes. Also it is possible to get the actual
  * vertical bit position in the vertical page.
  */
-struct {
+typedef struct {
     struct {
         uint8_t page;
         uint8_t bit;
     } height;
     uint8_t width;
-} dogmGraphic_writePointer;
+} writePointer_t;
+
+#define dogmGraphic_writePointer    (dogmGraphic_display->writePointer)
+
+/*! @brief clip rectangle
+ *
+ * @param x0    first visible column
+ * @param y0    first visible row
+ * @param x1    last visible column
+ * @param y1    last visible row
+ *
+ * All drawing functions only change pixels inside this rectangle of the x/y coordinate system. An empty rectangle with
+ * x0 > x1 or y0 > y1 hides everything.
+ */
+typedef struct {
+    uint8_t x0;
+    uint8_t y0;
+    uint8_t x1;
+    uint8_t y1;
+} clipRect_t;
+
+/*! @brief offscreen canvas
+ *
+ * @param buffer    page organized like the display ram, width bytes for every 8 rows
+ * @param width     width in pixel, at most DOGM_DISPLAY_WIDTH
+ * @param height    height in pixel, at most DOGM_DISPLAY_HEIGHT
+ * @param clip      clip rectangle, while drawing into the canvas
+ */
+typedef struct {
+    uint8_t *buffer;
+    uint8_t width;
+    uint8_t height;
+    clipRect_t clip;
+} dogmCanvas_t;
+
+/*! @brief one display with its own ram copy
+ *
+ * @param content           ram copy, see display_content
+ * @param newContent        changed pages, see dogmGraphic_newContent
+ * @param newColumns        changed columns, see dogmGraphic_newColumns
+ * @param writePointer      low level cursor, see dogmGraphic_writePointer
+ * @param scrollOffset      ram row of the logical row 0
+ * @param startLinePending  start line has to be sent with the next flush
+ * @param shadow            bytes sent at last, only with DOGM_USE_SHADOW_RAM
+ * @param shadowValid       pages of the shadow copy, which are known
+ * @param gray              lower bit-planes, only with DOGM_GRAY_PLANES
+ * @param grayColumns       columns drawn in the lower bit-planes
+ * @param grayPages         pages with valid grayColumns
+ * @param grayFrame         actual frame of the grayscale cycle
+ * @param grayShown         bit-plane sent at last
+ * @param clip              clip rectangle of all drawing functions
+ * @param pins              chip select and A0
+ * @param font              actual font, see draw_font_actualFont
+ * @param cursor            text cursor, see draw_font_actualCursor
+ * @param next              next display of the flush; NULL=display not added
+ *
+ * Every display on the SPI has its own instance. All drawing functions work on the display bound with
+ * dogmGraphic_bind, the well known globals like display_content are only names for the parts of this display. One
+ * instance needs DOGM_DISPLAY_PAGES * DOGM_DISPLAY_WIDTH bytes plus some bytes of ram, twice with DOGM_USE_SHADOW_RAM.
+ */
+typedef struct dogmDisplay {
+    uint8_t content[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+    newContent_t newContent;
+    newColumns_t newColumns[DOGM_DISPLAY_PAGES];
+    writePointer_t writePointer;
+    uint8_t scrollOffset;
+    uint8_t startLinePending;
+#if DOGM_USE_SHADOW_RAM
+    uint8_t shadow[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+    uint8_t shadowValid;
+#endif
+#if DOGM_GRAY_PLANES
+    uint8_t gray[DOGM_GRAY_PLANES - 1][DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+    newColumns_t grayColumns[DOGM_DISPLAY_PAGES];
+    uint8_t grayPages;
+    uint8_t grayFrame;
+    uint8_t grayShown;
+#endif
+    clipRect_t clip;
+    dogm_pins_t pins;
+    const fontData_t *font;
+    cursor_t cursor;
+    struct dogmDisplay *next;
+} dogmDisplay_t;
+
+/*! @brief display with the pins of sys_src/iodef.h
+ *
+ * This display is bound after the start, so a single display does not need any of the functions below.
+ */
+extern dogmDisplay_t dogmGraphic_defaultDisplay;
+
+/*! @brief actual display of all drawing functions
+ */
+extern dogmDisplay_t *dogmGraphic_display;
 
 /*******************************************************************************
  * init
@@ -105,10 +278,45 @@ struct {
 /*! @brief graphic init
  *
  * This function initialise the ram copy and clears it. It is very imported, that this function is used at first in the
- * beginning of the main function. This function should only be used once.
+ * beginning of the main function. This function should only be used once. With DOGM_USE_SHADOW_RAM it has to follow
+ * every dogm_init, because the display ram is unknown after a reset. It initialises the bound display, so every
+ * further display needs its own call.
  */
 void dogmGraphic_init(void);
 
+/*! @brief bind a display
+ *
+ * @param display   display for all following drawing functions and commands
+ *
+ * This function switches the ram copy, the dirty pages, the text cursor, the font and the pins of all following
+ * calls. Binding is only a pointer change, so it can be done at any time, even while a flush is running.
+ */
+void dogmGraphic_bind(dogmDisplay_t *display);
+
+/*! @brief add a display to the flush
+ *
+ * @param display   new display
+ * @param pins      chip select and A0 of the new display
+ *
+ * This function adds a further display on the same SPI. The pins are set as outputs and the display is unselected.
+ * The asynchronous and the stepped flush send all added displays one after another, without releasing the bus in
+ * between. The display has to be bound, initialised with dogm_initController and dogmGraphic_init before drawing:
+ *
+ * dogmGraphic_addDisplay(&second, &secondPins);
+ * dogmGraphic_bind(&second);
+ * dogm_initController();
+ * dogmGraphic_init();
+ *
+ * @attention Displays are only added or removed, while no asynchronous or stepped flush is running.
+ */
+void dogmGraphic_addDisplay(dogmDisplay_t *display, const dogm_pins_t *pins);
+
+/*! @brief remove a display from the flush
+ *
+ * @param display   added display; if it is bound, the default display is bound instead
+ */
+void dogmGraphic_removeDisplay(dogmDisplay_t *display);
+
 /*! @brief write given page to display
  *
  * @param page  vertical page to update
@@ -117,20 +325,89 @@ void dogmGraphic_init(void);
  */
 void dogmGraphic_writeRamPage(uint8_t page);
 
+/*! @brief write given columns of a page to display
+ *
+ * @param page  vertical page to update
+ * @param start first column to update
+ * @param end   last column to update
+ *
+ * This function actualise the given columns of the vertical page on the display with the data of the ram copy.
+ */
+void dogmGraphic_writeRamColumns(uint8_t page, uint8_t start, uint8_t end);
+
 /*! @brief actualize display content
  *
- * This function actualise all vertical pages on the display given with the newContent struct. After all, the bits
- * in the parameter will be set to zero.
+ * This function actualise all vertical pages on the display given with the newContent struct. Only the changed
+ * column span of every page is sent. After all, the bits in the parameter will be set to zero.
  */
 void dogmGraphic_flushRam(void* unused);
 
+/*******************************************************************************
+ * asynchronous flush
+ ******************************************************************************/
+
+/*! @brief start interrupt driven flush
+ *
+ * @return  1=flush started or nothing to do; 0=last flush or a stepped flush is still running
+ *
+ * This function takes all pages given with the newContent struct and sends them to the display out of the SPI transfer
+ * complete interrupt. The newContent bits will be reset at once, so every page changed during the running flush will
+ * be sent with the next flush again. The function returns immediately, the main loop can render the next frame while
+ * the pages are on the wire. Global interrupts have to be enabled.
+ *
+ * @attention No other display function (dogm_cmd, dogm_data, dogmGraphic_writeRamPage) may be used while the flush is
+ * running. With the SPI clock of fosc/2 one byte only needs 16 cycles, so the interrupt overhead is bigger than the
+ * transfer itself. The asynchronous flush pays off with a slower SPI clock, or if the main loop has to react faster
+ * than a complete blocking flush takes.
+ */
+uint8_t dogmGraphic_flushRamAsyncStart(void);
+
+/*! @brief progress of the asynchronous flush
+ *
+ * @return  number of pages not completely sent yet
+ *
+ * This function returns the number of pages, which are still waiting or on the wire.
+ */
+uint8_t dogmGraphic_flushRamAsyncPending(void);
+
+/*! @brief asynchronous flush done
+ *
+ * @return  1=no flush is running; 0=flush is still running
+ *
+ * This function returns true, when the last started asynchronous flush is finished completely and the chip select
+ * of the display is released again.
+ */
+uint8_t dogmGraphic_flushRamAsyncDone(void);
+
+/*******************************************************************************
+ * stepped flush
+ ******************************************************************************/
+
+/*! @brief send a limited part of the flush
+ *
+ * @param budgetBytes   maximum number of bytes sent with this call, address commands included
+ *
+ * @return  1=flush complete or nothing to do; 0=call again to send the rest
+ *
+ * This function works like dogmGraphic_flushRam, but stops as soon as the budget is used up. The page and column
+ * reached are remembered and the next call resumes there, so a scheduler can bound the time spent in one call. The
+ * changed pages are taken with the first call like with the asynchronous flush, so changes made meanwhile are sent
+ * with the next flush. Every run costs three address bytes, also when resuming. At least one data byte is sent with
+ * every call, so small budgets still make progress. One byte takes 16 cycles at fosc/2 plus the loop overhead.
+ *
+ * @attention dogmGraphic_flushRamAsyncStart returns 0 until the stepped flush is complete. dogmGraphic_flushRam
+ * completes a pending stepped flush first.
+ */
+uint8_t dogmGraphic_flushStep(uint16_t budgetBytes);
+
 /*! @brief
  *
  * @param width     horizontal pos
  * @param height    vertical pos
  *
  * This function transforms the given coordinates of an x/y coordinate system into the deep page system for the display.
- * The height will be splitted in page and bit and the cursor will also be set width this coordinates.
+ * The height will be splitted in page and bit and the cursor will also be set width this coordinates. The scroll
+ * offset is added to the height, so the cursor always points to the ram row shown at the given position.
  */
 void dogmGraphic_setWritePointer(uint8_t width, uint8_t height);
 
@@ -176,6 +453,55 @@ uint8_t dogmGraphic_testHeightPage(uint8_t page, uint8_t bit);
  */
 void dogmGraphic_clearWholeDisplay(void);
 
+/*******************************************************************************
+ * scrolling
+ ******************************************************************************/
+
+/*! @brief scroll display content vertically
+ *
+ * @param lines     positive=content moves up; negative=content moves down
+ *
+ * This function rotates the mapping between the rows of the x/y coordinate system and the ram rows and moves the
+ * start line of the display with the next flush. No byte of the old content is moved, only the newly exposed rows are
+ * cleared and have to be drawn again. For a scroll by 8 lines this is one page instead of the whole display. A scroll
+ * by 64 lines or more clears the whole display.
+ *
+ * Example: dogmGraphic_scroll(8) moves all lines up by one page, the new text line is drawn at y=56.
+ */
+void dogmGraphic_scroll(int8_t lines);
+
+/*! @brief actual scroll offset
+ *
+ * @return  ram row of the logical row 0, equal to the start line of the display after the next flush
+ */
+uint8_t dogmGraphic_getScrollOffset(void);
+
+/*******************************************************************************
+ * clipping
+ ******************************************************************************/
+
+/*! @brief restrict drawing to a rectangle
+ *
+ * @param x0    first visible column
+ * @param y0    first visible row
+ * @param x1    last visible column, limited to the display
+ * @param y1    last visible row, limited to the display
+ *
+ * This function sets the clip rectangle of the bound display, e.g. the viewport of a widget. Lines, areas, circles and
+ * images are clipped once against it before they are rasterized, so parts outside neither cost time nor log warnings.
+ */
+void dogmGraphic_setClip(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+
+/*! @brief draw on the whole display again
+ */
+void dogmGraphic_resetClip(void);
+
+/*! @brief actual clip rectangle
+ *
+ * @return  clip rectangle of the bound display, e.g. to restore it after drawing a widget
+ */
+clipRect_t dogmGraphic_getClip(void);
+
 /*! @brief generate specific byte
  *
  * @param number    number of bit to set in byte
@@ -231,17 +557,69 @@ void dogmGraphic_setVerticalPattern(uint8_t *verticalPattern, uint8_t startVerti
  * @param type          type to draw pixel
  *
  * This generic function sets a number of pixel on the screen specified with the given type. The rectangle area starts
- * with the given coordinate values in x/y coordinate system on the top left corner.
+ * with the given coordinate values in x/y coordinate system on the top left corner. Every page is changed with one
+ * kernel per draw type over a row of columns, completely covered pages are written with memset.
  */
 void dogmGraphic_drawArea(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
                           dogmGraphic_drawType_t type);
 
+/*! @brief predefined hatches
+ *
+ * @param DOGM_HATCH_HORIZONTAL     horizontal lines every fourth row
+ * @param DOGM_HATCH_VERTICAL       vertical lines every fourth column
+ * @param DOGM_HATCH_DIAGONAL_DOWN  lines from top left to bottom right
+ * @param DOGM_HATCH_DIAGONAL_UP    lines from bottom left to top right
+ * @param DOGM_HATCH_CROSS          horizontal and vertical lines
+ * @param DOGM_HATCH_CHECKER        checkerboard of single pixels
+ */
+typedef enum {
+    DOGM_HATCH_HORIZONTAL = 0,
+    DOGM_HATCH_VERTICAL,
+    DOGM_HATCH_DIAGONAL_DOWN,
+    DOGM_HATCH_DIAGONAL_UP,
+    DOGM_HATCH_CROSS,
+    DOGM_HATCH_CHECKER
+} dogmGraphic_hatch_t;
+
+/*! @brief generate an ordered dither pattern
+ *
+ * @param pattern   uint8_t array of 8 columns
+ * @param level     number of set pixels out of 64, from 0= empty to 64= full
+ *
+ * The pixels are chosen by an 8x8 bayer matrix, every level contains all pixels of the levels below. Each byte is one
+ * column, bit 0 is the top row.
+ */
+void dogmGraphic_setDitherPattern(uint8_t *pattern, uint8_t level);
+
+/*! @brief generate a hatch pattern
+ *
+ * @param pattern   uint8_t array of 8 columns
+ * @param hatch     kind of hatch
+ */
+void dogmGraphic_setHatchPattern(uint8_t *pattern, dogmGraphic_hatch_t hatch);
+
+/*! @brief draw a rectangle area filled with a pattern
+ *
+ * @param start_x       start position in horizontal direction at top left in x/y coordinate system
+ * @param start_y       start position in vertical direction at top left in x/y coordinate system
+ * @param deltaWidth    width of the drawn rectangle
+ * @param deltaHeight   height of the drawn rectangle
+ * @param pattern       uint8_t array of 8 columns, bit 0 is the top row
+ * @param type          type to draw the set pattern pixel; DOGM_SET also clears the other pixel of the area
+ *
+ * The pattern repeats every 8 pixel and is fixed to the x/y coordinate system, so neighbouring areas continue it
+ * seamless. Every column combines its pattern byte with the page mask, a pattern costs the same as a solid area.
+ */
+void dogmGraphic_drawPatternArea(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                                 const uint8_t *pattern, dogmGraphic_drawType_t type);
+
 /*! @brief set one pixel
  *
  * @param x     horizontal position
  * @param y     vertical position
  *
  * This function sets one pixel in the x/y coordinate system. This function is often used in abstract figure functions.
+ * A pixel outside of the clip rectangle is skipped without a warning.
  */
 void dogmGraphic_drawDot(uint8_t x, uint8_t y);
 
@@ -263,25 +641,294 @@ int8_t dogmGraphic_sgn(int8_t x);
  * @param end_y     vertical end position
  * @param lineType  0=filled, 1=dotted, 2=dashed
  *
+ * The line is clipped once before it is drawn. Cohen-Sutherland outcodes reject lines completely outside of the clip
+ * rectangle, a line crossing its border starts the Bresenham loop at its first visible step. So the visible pixels and
+ * the dot or dash pattern are exactly the same as of the unclipped line.
+ *
  * @see https://de.wikipedia.org/wiki/Bresenham-Algorithmus
  */
 void dogmGraphic_drawLineXY(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint8_t lineType);
 
-/*! @brief Bresenham-Algorithmus Kreis
+/*! @brief draw a circle
  *
  * @param start_x   horizontal start position
  * @param start_y   vertical start position
  * @param radius    half diameter of the circle
  * @param filled    1= completely fill circle; 0= only outline circle
  *
- * @see https://de.wikipedia.org/wiki/Bresenham-Algorithmus
+ * A circle is an ellipse with the same radius in both directions, see dogmGraphic_drawEllipse.
  */
 void dogmGraphic_drawCircleOutline(uint8_t start_x, uint8_t start_y, uint8_t radius, uint8_t filled);
 
+/*! @brief draw an ellipse
+ *
+ * @param start_x   horizontal middle position
+ * @param start_y   vertical middle position
+ * @param radius_x  horizontal half diameter
+ * @param radius_y  vertical half diameter
+ * @param filled    1= completely fill ellipse; 0= only outline ellipse
+ *
+ * The ellipse is drawn column by column as vertical spans through page masks. A filled ellipse writes every column
+ * once, an outline spans the rows between the half heights of neighbouring columns, so it has no gaps. An ellipse may
+ * exceed the display or the clip rectangle, only its visible part is drawn.
+ */
+void dogmGraphic_drawEllipse(uint8_t start_x, uint8_t start_y, uint8_t radius_x, uint8_t radius_y, uint8_t filled);
+
+/*! @brief draw a line with a stroke width
+ *
+ * @param start_x   horizontal start position
+ * @param start_y   vertical start position
+ * @param end_x     horizontal end position
+ * @param end_y     vertical end position
+ * @param width     stroke width in pixel, 1 is the same as a filled dogmGraphic_drawLineXY
+ *
+ * The line is filled as a quadrangle with the width perpendicular to the line and square ends at the points, one
+ * vertical span per column. Horizontal and vertical lines are areas. The stroke may exceed the display.
+ */
+void dogmGraphic_drawLineStroke(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint8_t width);
+
+/*! @brief draw a rectangle outline with a stroke width
+ *
+ * @param start_x       start position in horizontal direction at top left in x/y coordinate system
+ * @param start_y       start position in vertical direction at top left in x/y coordinate system
+ * @param deltaWidth    width of the rectangle
+ * @param deltaHeight   height of the rectangle
+ * @param width         stroke width in pixel, drawn to the inside
+ *
+ * The outline is drawn as four areas, so the outer size is kept for every width.
+ */
+void dogmGraphic_drawRectangleStroke(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                                     uint8_t width);
+
+/*! @brief draw a circle outline with a stroke width
+ *
+ * @param start_x   horizontal middle position
+ * @param start_y   vertical middle position
+ * @param radius    outer half diameter of the circle
+ * @param width     stroke width in pixel, drawn to the inside
+ *
+ * See dogmGraphic_drawEllipseStroke.
+ */
+void dogmGraphic_drawCircleStroke(uint8_t start_x, uint8_t start_y, uint8_t radius, uint8_t width);
+
+/*! @brief draw an ellipse outline with a stroke width
+ *
+ * @param start_x   horizontal middle position
+ * @param start_y   vertical middle position
+ * @param radius_x  outer horizontal half diameter
+ * @param radius_y  outer vertical half diameter
+ * @param width     stroke width in pixel, drawn to the inside
+ *
+ * The ring between the ellipse and the one smaller by the width is drawn column by column with one span above and one
+ * below the hole. A width of 1 is the same as the outline of dogmGraphic_drawEllipse, a width above a radius fills it.
+ */
+void dogmGraphic_drawEllipseStroke(uint8_t start_x, uint8_t start_y, uint8_t radius_x, uint8_t radius_y,
+                                   uint8_t width);
+
+/*! @brief fixed point 1.0 of the sine and cosine values, they have 14 fraction bits
+ */
+#define DOGM_TRIG_ONE 16384
+
+/*! @brief sine of an angle
+ *
+ * @param angle     angle in degree, any value
+ * @return          sine in fixed point, DOGM_TRIG_ONE is 1.0
+ *
+ * The value is read from a table in the flash memory, there is no float on the way.
+ */
+int16_t dogmGraphic_sin(int16_t angle);
+
+/*! @brief cosine of an angle
+ *
+ * @param angle     angle in degree, any value
+ * @return          cosine in fixed point, DOGM_TRIG_ONE is 1.0
+ */
+int16_t dogmGraphic_cos(int16_t angle);
+
+/*! @brief draw an arc or a ring segment
+ *
+ * @param start_x   horizontal middle position
+ * @param start_y   vertical middle position
+ * @param radius    outer radius
+ * @param start     first angle in degree, 0 is to the right and the angles grow counterclockwise
+ * @param end       last angle in degree, start + 360 draws the whole ring and start itself draws nothing
+ * @param width     stroke width in pixel, drawn to the inside
+ *
+ * The ring of dogmGraphic_drawCircleStroke is cut by the two rays of the angles. Every column of the ring is clipped
+ * against the rays with two integer divisions, so the arc is drawn as column spans like a filled figure.
+ */
+void dogmGraphic_drawArc(uint8_t start_x, uint8_t start_y, uint8_t radius, int16_t start, int16_t end, uint8_t width);
+
+/*! @brief draw a filled pie segment
+ *
+ * @param start_x   horizontal middle position
+ * @param start_y   vertical middle position
+ * @param radius    radius
+ * @param start     first angle in degree, see dogmGraphic_drawArc
+ * @param end       last angle in degree
+ */
+void dogmGraphic_drawPie(uint8_t start_x, uint8_t start_y, uint8_t radius, int16_t start, int16_t end);
+
+/*! @brief draw a gauge needle
+ *
+ * @param start_x   horizontal middle position
+ * @param start_y   vertical middle position
+ * @param inner     radius of the start of the needle
+ * @param outer     radius of the tip of the needle
+ * @param angle     angle in degree, see dogmGraphic_drawArc
+ * @param width     stroke width in pixel
+ *
+ * The needle is a stroke like dogmGraphic_drawLineStroke, so it is cheap enough to be erased and drawn again for every
+ * frame of an animation. Its ends may lie outside of the display, it is clipped like every other stroke.
+ */
+void dogmGraphic_drawNeedle(uint8_t start_x, uint8_t start_y, uint8_t inner, uint8_t outer, int16_t angle,
+                            uint8_t width);
+
+/*! @brief draw a rectangle with rounded corners
+ *
+ * @param start_x       horizontal start position
+ * @param start_y       vertical start position
+ * @param deltaWidth    width
+ * @param deltaHeight   height
+ * @param radius        corner radius, it is limited to the half of the smaller side
+ * @param fill          0 draws the outline, 1 fills the rectangle
+ */
+void dogmGraphic_drawRoundedRectangle(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                                      uint8_t radius, uint8_t fill);
+
+/*! @brief draw the outline of a rectangle with rounded corners with a stroke width
+ *
+ * @param start_x       horizontal start position
+ * @param start_y       vertical start position
+ * @param deltaWidth    width
+ * @param deltaHeight   height
+ * @param radius        outer corner radius, it is limited to the half of the smaller side
+ * @param width         stroke width in pixel, drawn to the inside
+ *
+ * The straight parts are areas and the corners are column spans of a circle ring. The inner corners have the radius
+ * reduced by the width, so the stroke keeps its width around the corners.
+ */
+void dogmGraphic_drawRoundedRectangleStroke(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                                            uint8_t radius, uint8_t width);
+
+/*! @brief fill a convex polygon
+ *
+ * @param points    corners in drawing order
+ * @param count     number of corners
+ * @param type      type to draw pixel
+ *
+ * The edges are rasterized like dogmGraphic_drawLineXY into the top and bottom row of every column, afterwards each
+ * column is written once as a vertical span with the kernel of dogmGraphic_drawArea. So the filled polygon covers its
+ * outline exactly. A concave polygon is filled up to its top and bottom edge in every column.
+ */
+void dogmGraphic_drawPolygon(const coordinatePoint_t *points, uint8_t count, dogmGraphic_drawType_t type);
+
+/*! @brief fill a triangle
+ *
+ * @param x0    horizontal position of corner A
+ * @param y0    vertical position of corner A
+ * @param x1    horizontal position of corner B
+ * @param y1    vertical position of corner B
+ * @param x2    horizontal position of corner C
+ * @param y2    vertical position of corner C
+ * @param type  type to draw pixel
+ *
+ * @see dogmGraphic_drawPolygon
+ */
+void dogmGraphic_drawTriangle(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2,
+                              dogmGraphic_drawType_t type);
+
 /*******************************************************************************
  * draw PROGMEM pics
  ******************************************************************************/
 
+/*! @brief memory of bitmap data
+ *
+ * @param DOGM_MEMORY_RAM       data in ram
+ * @param DOGM_MEMORY_PROGMEM   data in flash
+ */
+typedef enum {
+    DOGM_MEMORY_RAM = 0, DOGM_MEMORY_PROGMEM
+} dogmGraphic_memory_t;
+
+/*! @brief format of bitmap data
+ *
+ * @param DOGM_BITMAP_RAW   page organized bytes like the display ram
+ * @param DOGM_BITMAP_RLE   the same bytes, run length encoded, see DOGM_RLE_LITERAL
+ */
+typedef enum {
+    DOGM_BITMAP_RAW = 0, DOGM_BITMAP_RLE
+} dogmGraphic_bitmapFormat_t;
+
+/*! @brief codes of run length encoded bitmaps
+ *
+ * The bytes of all pages are encoded as one stream of runs, a run may go on into the next page. Every run starts with
+ * a code byte, its two high bits are the kind and its six low bits are the length of the run minus 1:
+ * DOGM_RLE_LITERAL is followed by the bytes themselves, DOGM_RLE_ZEROS and DOGM_RLE_ONES stand for bytes of 0x00 and
+ * 0xFF and DOGM_RLE_REPEAT is followed by one byte, which is repeated.
+ */
+#define DOGM_RLE_LITERAL    0x00
+#define DOGM_RLE_ZEROS      0x40
+#define DOGM_RLE_ONES       0x80
+#define DOGM_RLE_REPEAT     0xC0
+#define DOGM_RLE_COUNT      0x3F
+
+/*! @brief bitmap source of the blitter
+ *
+ * @param data      page organized like the display ram, width bytes for every 8 rows
+ * @param width     width in pixel of the whole bitmap, e.g. of a sprite sheet
+ * @param height    height in pixel of the whole bitmap
+ * @param memory    memory of the data
+ * @param format    format of the data, it may be left out for raw bytes
+ */
+typedef struct {
+    const void *data;
+    uint8_t width;
+    uint8_t height;
+    dogmGraphic_memory_t memory;
+    dogmGraphic_bitmapFormat_t format;
+} dogmGraphic_bitmap_t;
+
+/*! @brief copy a part of a bitmap on screen
+ *
+ * @param start_x   horizontal start position on top left corner
+ * @param start_y   vertical start position on top left corner
+ * @param source    bitmap to copy from
+ * @param source_x  first column of the bitmap, e.g. of a sprite in a sprite sheet
+ * @param source_y  first row of the bitmap
+ * @param width     width in pixel of the copied part
+ * @param height    height in pixel of the copied part
+ * @param type      DOGM_ADD sets, DOGM_CLEAR clears the set pixels of the bitmap, DOGM_SET copies the bitmap and
+ *                  DOGM_INVERT copies the inverted bitmap
+ *
+ * The part is clipped once against the bitmap and the clip rectangle. The blitter streams every source column once from
+ * top to bottom. The vertical offset between source and display is applied with one multiplication per byte, the bits
+ * shifted out of a page are carried into the next one. Run length encoded bitmaps are decoded on the fly page by page,
+ * the skipped columns and pages cost one step per run. They are not kept in the sprite cache.
+ */
+void dogmGraphic_blit(uint8_t start_x, uint8_t start_y, const dogmGraphic_bitmap_t *source, uint8_t source_x,
+                      uint8_t source_y, uint8_t width, uint8_t height, dogmGraphic_drawType_t type);
+
+/*! @brief empty the sprite cache
+ *
+ * This function forgets all cached flash bitmaps and resets the counters. It has to be called, if the flash data of a
+ * cached bitmap changes, e.g. after a bootloader update.
+ */
+void dogmGraphic_clearCache(void);
+
+/*! @brief hits of the sprite cache
+ *
+ * @return  number of flash bitmaps drawn from the cache, 0 without DOGM_SPRITE_CACHE_ENTRIES
+ */
+uint16_t dogmGraphic_getCacheHits(void);
+
+/*! @brief misses of the sprite cache
+ *
+ * @return  number of flash bitmaps, which had to be shifted again or were too large, 0 without
+ *          DOGM_SPRITE_CACHE_ENTRIES
+ */
+uint16_t dogmGraphic_getCacheMisses(void);
+
 /*! @brief draw data from flash on screen
  *
  * @param start_x       horizontal start position on top left corner
@@ -291,9 +938,192 @@ void dogmGraphic_drawCircleOutline(uint8_t start_x, uint8_t start_y, uint8_t rad
  * @param type          type to draw pixel
  * @param progMemSpace  start byte of data in flash
  *
- * This function draws data from flash to screen in the specific area.
+ * This function draws data from flash to screen in the specific area. The image may exceed the right or bottom border
+ * of the display, only the columns and pages inside the clip rectangle are read.
+ *
+ * @see dogmGraphic_blit
  */
 void dogmGraphic_drawP(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
                        dogmGraphic_drawType_t type, const void *progMemSpace);
 
+/*******************************************************************************
+ * offscreen canvases
+ ******************************************************************************/
+
+/*! @brief create a canvas in the static arena
+ *
+ * @param canvas    canvas to initialize
+ * @param width     width in pixel, at most DOGM_DISPLAY_WIDTH
+ * @param height    height in pixel, at most DOGM_DISPLAY_HEIGHT
+ * @return          1 on success, 0 if the size is out of range or the arena of DOGM_CANVAS_ARENA_BYTES is full
+ *
+ * The canvas is empty and its clip rectangle covers it completely. A canvas lives until dogmGraphic_releaseCanvases.
+ */
+uint8_t dogmGraphic_createCanvas(dogmCanvas_t *canvas, uint8_t width, uint8_t height);
+
+/*! @brief give the whole arena back
+ *
+ * All canvases become invalid and drawing goes to the bound display again.
+ */
+void dogmGraphic_releaseCanvases(void);
+
+/*! @brief draw into a canvas
+ *
+ * @param canvas    canvas for all following drawing functions, NULL for the bound display
+ *
+ * Lines, figures, images and text render into the canvas with its own clip rectangle, dogmGraphic_setClip changes the
+ * one of the canvas. The canvas does not scroll and is never flushed.
+ */
+void dogmGraphic_drawToCanvas(dogmCanvas_t *canvas);
+
+/*! @brief clear a canvas
+ *
+ * @param canvas    canvas to clear
+ */
+void dogmGraphic_clearCanvas(dogmCanvas_t *canvas);
+
+/*! @brief compose a canvas onto the drawing target
+ *
+ * @param start_x   horizontal start position on top left corner
+ * @param start_y   vertical start position on top left corner
+ * @param canvas    canvas to copy, not the actual drawing target
+ * @param type      type to draw pixel, see dogmGraphic_blit
+ *
+ * A widget rendered once into a canvas is copied with the blitter onto the display or another canvas every frame.
+ */
+void dogmGraphic_blitCanvas(uint8_t start_x, uint8_t start_y, const dogmCanvas_t *canvas,
+                            dogmGraphic_drawType_t type);
+
+/*******************************************************************************
+ * save under
+ ******************************************************************************/
+
+/*! @brief content under a popup
+ *
+ * @param buffer    saved pages, NULL after the restore
+ * @param arena     1, if the buffer was taken from the arena of DOGM_CANVAS_ARENA_BYTES
+ * @param x         first column
+ * @param row       first ram row, the scroll offset is already added
+ * @param width     number of columns
+ * @param height    number of rows
+ */
+typedef struct {
+    uint8_t *buffer;
+    uint8_t arena;
+    uint8_t x;
+    uint8_t row;
+    uint8_t width;
+    uint8_t height;
+} dogmSaveUnder_t;
+
+/*! @brief buffer size for dogmGraphic_saveUnder
+ *
+ * The rows are saved in whole pages, a rectangle crossing page borders needs one page more than its height.
+ */
+#define DOGM_SAVE_UNDER_BYTES(width, height)   ((uint16_t) (width) * (((height) + 14) >> 3))
+
+/*! @brief save a rectangle before an overlay is drawn
+ *
+ * @param save      saved rectangle
+ * @param buffer    DOGM_SAVE_UNDER_BYTES(width, height) bytes, NULL to take them from the arena
+ * @param x         horizontal start position on top left corner
+ * @param y         vertical start position on top left corner
+ * @param width     width in pixel
+ * @param height    height in pixel
+ * @return          1 on success, 0 if the position is out of range or the arena is full
+ *
+ * The pages of the rectangle are copied byte by byte from the actual drawing target. Nothing is marked as changed.
+ */
+uint8_t dogmGraphic_saveUnder(dogmSaveUnder_t *save, uint8_t *buffer, uint8_t x, uint8_t y, uint8_t width,
+                              uint8_t height);
+
+/*! @brief restore a saved rectangle, when the overlay is dismissed
+ *
+ * @param save      rectangle saved with dogmGraphic_saveUnder
+ *
+ * The rectangle is copied back to the same ram rows, only its pages and columns are marked as changed. Rows of the
+ * first and last page outside of the rectangle are not touched. Arena buffers of nested overlays are given back, when
+ * they are restored in reverse order.
+ */
+void dogmGraphic_restoreUnder(dogmSaveUnder_t *save);
+
+#if DOGM_GRAY_PLANES
+/*******************************************************************************
+ * grayscale
+ ******************************************************************************/
+
+/*! @brief number of gray levels, 0 is white and DOGM_GRAY_LEVELS - 1 black
+ */
+#define DOGM_GRAY_LEVELS    (1 << DOGM_GRAY_PLANES)
+
+/*! @brief number of frames of one grayscale cycle
+ *
+ * The bit-plane of bit k is shown in 2^k frames of the cycle, so a pixel is black in level frames.
+ */
+#define DOGM_GRAY_FRAMES    (DOGM_GRAY_LEVELS - 1)
+
+/*! @brief start the grayscale mode with the bound display
+ *
+ * The display is flushed once, afterwards dogmGraphic_grayTick sends all changes. dogmGraphic_flushRam and the
+ * asynchronous or stepped flushes do nothing, until dogmGraphic_grayStop is called.
+ */
+void dogmGraphic_grayStart(void);
+
+/*! @brief stop the grayscale mode
+ *
+ * The columns of the lower bit-planes are marked as changed, so the next flush shows display_content again.
+ */
+void dogmGraphic_grayStop(void);
+
+/*! @brief send the next frame of the grayscale cycle
+ *
+ * @return  1= frame sent; 0= nothing to send or an asynchronous flush is running
+ *
+ * This function has to be called from a timer interrupt of the application at a fixed rate of DOGM_GRAY_FRAMES times
+ * the wanted cycle rate, e.g. 150Hz for 50Hz with 2 planes. Every frame sends the bit-plane of the frame, but only the
+ * columns drawn in the lower bit-planes and the changes of display_content. Outside of these columns, the display
+ * shows display_content like in the monochrome mode. display_content is the most significant bit-plane and the only
+ * one shown twice in a row, the second frame is skipped, if nothing changed.
+ */
+uint8_t dogmGraphic_grayTick(void);
+
+/*! @brief set the bit-plane, all drawing functions render into
+ *
+ * @param plane     0 for the least significant bit, DOGM_GRAY_PLANES - 1 for display_content
+ *
+ * Drawing into a lower bit-plane marks its columns as gray, they are sent with every frame from now on. A bound canvas
+ * is drawn before any plane.
+ */
+void dogmGraphic_drawToPlane(uint8_t plane);
+
+/*! @brief clear the lower bit-planes of the bound display
+ *
+ * Their columns are not gray anymore and show display_content again.
+ */
+void dogmGraphic_clearGray(void);
+
+/*! @brief draw a rectangle area with a gray level
+ *
+ * @param start_x       start position in horizontal direction at top left in x/y coordinate system
+ * @param start_y       start position in vertical direction at top left in x/y coordinate system
+ * @param deltaWidth    width of the drawn rectangle
+ * @param deltaHeight   height of the drawn rectangle
+ * @param level         gray level up to DOGM_GRAY_LEVELS - 1
+ *
+ * The area is set in every bit-plane of a set bit of the level and cleared in all others.
+ */
+void dogmGraphic_drawGrayArea(uint8_t start_x, uint8_t start_y, uint8_t deltaWidth, uint8_t deltaHeight,
+                              uint8_t level);
+
+/*! @brief fill a convex polygon with a gray level
+ *
+ * @param points    corners in drawing order
+ * @param count     number of corners
+ * @param level     gray level up to DOGM_GRAY_LEVELS - 1
+ *
+ * See dogmGraphic_drawPolygon, e.g. for the shading below a trend.
+ */
+void dogmGraphic_drawGrayPolygon(const coordinatePoint_t *points, uint8_t count, uint8_t level);
+#endif
+
 #endif //MCU_DOGM_GRAPHIC_H
\ No newline at end of file
@@ -29,38 +29,50 @@
  * #####################################################################################################################
  */
 
-#include <util/delay.h>
-#include <avr/interrupt.h>
 #include "dogm128.h"
 
+static const dogm_pins_t dogm_defaultPins = DOGM_PINS_DEFAULT;
+const dogm_pins_t *dogm_pins = &dogm_defaultPins;
+
 void dogm_init(void) {
     DOGM_SET_DDR();
     dogm_init_spi();
 
     DOGM_RESET();
-    _delay_ms(1);
+    DOGM_DELAY_MS(1);
     DOGM_RUN();
 
-    DOGM_USE_FIRST_LINE(0);
+    dogm_initController();
+}
+
+void dogm_initController(void) {
+    DOGM_SET_DDR();
+
+    const uint8_t initSequence[] = {
+            DOGM_START_LINE | 0,
 #ifdef DOGM_IS_TOPVIEW
-    DOGM_USE_TOP_VIEW();
-    DOGM_SCAN_UPSIDEDOWN();
+            DOGM_BOTTOMVIEW | 0,            // top view
+            DOGM_SCAN_DIR | 0x8,            // scan upside down
 #else
-    DOGM_USE_BOTTOM_VIEW();
-    DOGM_SCAN_NORMAL();
+            DOGM_BOTTOMVIEW | 1,            // bottom view
+            DOGM_SCAN_DIR | 0x0,            // scan normal
 #endif
-
-    DOGM_ALL_PIXELS_OFF();
-    DOGM_USE_MODE_POSITIVE();
-    DOGM_USE_BIAS_RATIO_1_7();
-    DOGM_USE_LOW_POWER();
-    DOGM_USE_BIAS_VOLTAGE(0x07);
-    DOGM_USE_VOLUME_MODE(DOGM_CONTRAST);
-    DOGM_USE_INDICATOR_OFF();
-
-    DOGM_ON();
-
-    DOGM_GOTO_ADDRESS(0, 0);
+            DOGM_ALL_PIXEL | 0,             // all pixels off
+            DOGM_DISPLAY_INVERT | 0,        // mode positive
+            DOGM_BIAS | 1,                  // bias ratio 1/7
+            DOGM_POWER_CONTROL | 0x7,       // low power
+            DOGM_VOLTAGE | 0x07,
+            DOGM_VOLUME_MODE, (DOGM_CONTRAST & 0x3F),
+            DOGM_INDICATOR | 0, 0x00,       // indicator off
+            DOGM_DISPLAY_ENABLE | 1,        // on
+            DOGM_PAGE_ADDR_CMD(0),
+            DOGM_COLUMN_ADDR_CMD_HIGH(0),
+            DOGM_COLUMN_ADDR_CMD_LOW(0)
+    };
+
+    dogm_beginTransfer();
+    dogm_cmdBurst(initSequence, sizeof(initSequence));
+    dogm_endTransfer();
 }
 
 
@@ -83,7 +95,7 @@ inline void dogm_send(uint8_t byte) {
     DOGM_INIT_SPI();
 
     DOGM_SELECT();
-    DOGM_SPIDR = byte;
+    DOGM_SPI_WRITE(byte);
     DOGM_BUSY_WAITING();
     DOGM_UNSELECT();
 
@@ -92,8 +104,69 @@ inline void dogm_send(uint8_t byte) {
     //SPSR = SPSRbak;
 }
 
+inline void dogm_beginTransfer(void) {
+    DOGM_INIT_SPI();
+    DOGM_SPI_CLEAR_FLAG();
+    DOGM_SELECT();
+}
+
+inline void dogm_endTransfer(void) {
+    DOGM_UNSELECT();
+}
+
+/*! @brief send bytes as burst
+ *
+ * @param bytes first byte in ram
+ * @param len   number of bytes
+ *
+ * This internal function keeps the SPI busy. The next byte is loaded from ram, while the last one is on the wire, so
+ * only the check of the SPIF flag is left between two bytes. The function returns after the last byte is completely
+ * sent, so A0 can be changed afterwards.
+ */
+static inline void dogm_sendBurst(const uint8_t* bytes, uint8_t len) {
+    if (!len) {
+        return;
+    }
+
+    DOGM_SPI_WRITE(*bytes++);
+    while (--len) {
+        uint8_t next = *bytes++;
+        DOGM_BUSY_WAITING();
+        DOGM_SPI_WRITE(next);
+    }
+    DOGM_BUSY_WAITING();
+}
+
+void dogm_cmdBurst(const uint8_t* cmd, uint8_t len) {
+    DOGM_COMMAND();
+    dogm_sendBurst(cmd, len);
+}
+
+void dogm_dataBurst(const uint8_t* data, uint8_t len) {
+    DOGM_DATA();
+    dogm_sendBurst(data, len);
+}
+
+void dogm_dataBurstCopy(const uint8_t* data, uint8_t* copy, uint8_t len) {
+    DOGM_DATA();
+    if (!len) {
+        return;
+    }
+
+    uint8_t next = *data++;
+    DOGM_SPI_WRITE(next);
+    *copy++ = next;
+    while (--len) {
+        next = *data++;
+        *copy++ = next;
+        DOGM_BUSY_WAITING();
+        DOGM_SPI_WRITE(next);
+    }
+    DOGM_BUSY_WAITING();
+}
+
 void dogm_init_spi(void) {
-    DISPDDR |= (1 << DISPMOSI) | (1 << DISPSCK);
+    DOGM_SET_DDR_SPI();
     DOGM_INIT_SPI();
     /*SPCR = (1 << SPE) | (1 << MSTR) | (1 << CPOL) | (1 << CPHA);
     SPSR = (1 << SPI2X);
@@ -34,15 +34,24 @@
 #define MCU_DOGM128_H
 
 #include <stdint.h>
-#include "../sys_src/iodef.h"
+#include "hal/dogm128-hal.h"
 
 //Display dimension
 #define DOGM_DISPLAY_HEIGHT     64
 #define DOGM_DISPLAY_WIDTH      128
 #define DOGM_DISPLAY_PAGES      DOGM_DISPLAY_HEIGHT/8
 
+/*! @brief reset and init the display
+ * This function resets all displays on the RESET line and sends the init sequence to the display of dogm_pins.
+ */
 void dogm_init(void);
 
+/*! @brief init the display controller
+ * This function only sends the init sequence to the display of dogm_pins. Further displays on the same RESET line are
+ * initialised with it after dogm_init, because another reset would also clear the first display.
+ */
+void dogm_initController(void);
+
 void dogm_data(uint8_t data);
 
 void dogm_cmd(uint8_t cmd);
@@ -51,6 +60,50 @@ void dogm_send(uint8_t byte);
 
 void dogm_init_spi(void);
 
+/*! @brief start a burst transfer
+ *
+ * This function configures the SPI once and selects the display. Every following burst is sent without touching the
+ * SPI setup or the chip select again, until dogm_endTransfer is called.
+ */
+void dogm_beginTransfer(void);
+
+/*! @brief end a burst transfer
+ *
+ * This function releases the chip select of the display. All bytes of the bursts are completely on the wire already.
+ */
+void dogm_endTransfer(void);
+
+/*! @brief send commands as burst
+ *
+ * @param cmd   first command byte in ram
+ * @param len   number of command bytes
+ *
+ * This function sets A0 once and sends the given bytes as commands. The next byte is loaded, while the last one is
+ * still on the wire. It has to be called between dogm_beginTransfer and dogm_endTransfer.
+ */
+void dogm_cmdBurst(const uint8_t* cmd, uint8_t len);
+
+/*! @brief send data as burst
+ *
+ * @param data  first data byte in ram
+ * @param len   number of data bytes
+ *
+ * This function sets A0 once and sends the given bytes as display data. The next byte is loaded, while the last one is
+ * still on the wire. It has to be called between dogm_beginTransfer and dogm_endTransfer.
+ */
+void dogm_dataBurst(const uint8_t* data, uint8_t len);
+
+/*! @brief send data as burst and copy it
+ *
+ * @param data  first data byte in ram
+ * @param copy  destination for a copy of the sent bytes
+ * @param len   number of data bytes
+ *
+ * This function works like dogm_dataBurst. Every byte is also copied to the given destination, while it is on the
+ * wire. So a copy of the display ram can be updated without any extra time.
+ */
+void dogm_dataBurstCopy(const uint8_t* data, uint8_t* copy, uint8_t len);
+
 // Settings
 
 #define DOGM_IS_TOPVIEW         1
@@ -58,18 +111,7 @@ void dogm_init_spi(void);
 
 // Abbreviations (macros)
 
-#define DOGM_SET_DDR()          DISPDDR |= (1<<DISPCS)|(1<<DISPRESET)|(1<<DISPA0)
-#define DOGM_INIT_SPI()         SPCR = (1 << SPE) | (1 << MSTR) | (1 << CPOL) | (1 << CPHA);\
-                                SPSR = (1 << SPI2X);
-#define DOGM_SELECT()           DISPPORT &= ~(1<<DISPCS)
-#define DOGM_UNSELECT()         DISPPORT |= (1<<DISPCS)
-#define DOGM_COMMAND()          DISPPORT &= ~(1<<DISPA0)
-#define DOGM_DATA()             DISPPORT |= (1<<DISPA0)
-#define DOGM_RESET()            DISPPORT &= ~(1<<DISPRESET)
-#define DOGM_RUN()              DISPPORT |= (1<<DISPRESET); SPSR |= (1 << SPIF)
-
-#define DOGM_SPIDR              SPDR
-#define DOGM_BUSY_WAITING()     while(!(SPSR & (1<<SPIF)));
+// see hal/dogm128-hal.h
 
 // Commands
 
@@ -99,9 +141,12 @@ void dogm_init_spi(void);
 #define DOGM_ON()                       dogm_cmd(DOGM_DISPLAY_ENABLE | 1)
 #define DOGM_OFF()                      dogm_cmd(DOGM_DISPLAY_ENABLE | 0)
 #define DOGM_USE_FIRST_LINE(i)          dogm_cmd(DOGM_START_LINE | ((i) & 0x3F))
-#define DOGM_GOTO_PAGE_ADDR(i)          dogm_cmd(DOGM_PAGE_ADDRESS | ((i) & 0x0F))
-#define DOGM_GOTO_COLUMN_ADDR(col)      dogm_cmd(DOGM_COL_ADDRESS | ((((col)+DOGM_COLUMN_ADD)>>4) & 0x0F)); \
-                                        dogm_cmd((((col)+DOGM_COLUMN_ADD) & 0x0F))
+#define DOGM_PAGE_ADDR_CMD(i)           (DOGM_PAGE_ADDRESS | ((i) & 0x0F))
+#define DOGM_COLUMN_ADDR_CMD_HIGH(col)  (DOGM_COL_ADDRESS | ((((col)+DOGM_COLUMN_ADD)>>4) & 0x0F))
+#define DOGM_COLUMN_ADDR_CMD_LOW(col)   (((col)+DOGM_COLUMN_ADD) & 0x0F)
+#define DOGM_GOTO_PAGE_ADDR(i)          dogm_cmd(DOGM_PAGE_ADDR_CMD(i))
+#define DOGM_GOTO_COLUMN_ADDR(col)      dogm_cmd(DOGM_COLUMN_ADDR_CMD_HIGH(col)); \
+                                        dogm_cmd(DOGM_COLUMN_ADDR_CMD_LOW(col))
 #define DOGM_GOTO_ADDRESS(page, col)    DOGM_GOTO_PAGE_ADDR(page); \
                                         DOGM_GOTO_COLUMN_ADDR(col)
 #define DOGM_USE_BOTTOM_VIEW()          dogm_cmd(DOGM_BOTTOMVIEW | 1)
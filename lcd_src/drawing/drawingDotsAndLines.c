@@ -77,6 +77,11 @@ void draw_figure_lineCoordinates(coordinatePoint_t startPoint, coordinatePoint_t
     dogmGraphic_drawLineXY(startPoint.x, startPoint.y, endPoint.x, endPoint.y, type);
 }
 
+void draw_figure_lineThick(coordinatePoint_t startPoint, coordinatePoint_t endPoint, uint8_t width) {
+
+    dogmGraphic_drawLineStroke(startPoint.x, startPoint.y, endPoint.x, endPoint.y, width);
+}
+
 void draw_figure_arrowHorizontal(coordinatePoint_t startPoint, uint8_t length, draw_figure_line_t lineType,
                                  draw_figure_arrow_t startArrowType, draw_figure_arrow_t endArrowType) {
     // draw line
@@ -95,7 +100,18 @@ void draw_figure_arrowHorizontal(coordinatePoint_t startPoint, uint8_t length, d
             //draw no arrow
             break;
         case DRAW_ARROW_FILLED:
-            draw_figure_dotSmall((coordinatePoint_t) {startPoint.x + 1, startPoint.y});
+            draw_figure_triangleFilled(
+                    startPoint,
+                    (coordinatePoint_t) {
+                            startPoint.x + 2,
+                            startPoint.y + 2
+                    },
+                    (coordinatePoint_t) {
+                            startPoint.x + 2,
+                            startPoint.y - 2
+                    }
+            );
+            break;
         case DRAW_ARROW_OUTLINE:
             draw_figure_triangleOutline(
                     startPoint,
@@ -118,7 +134,21 @@ void draw_figure_arrowHorizontal(coordinatePoint_t startPoint, uint8_t length, d
             //draw no arrow
             break;
         case DRAW_ARROW_FILLED:
-            draw_figure_dotSmall((coordinatePoint_t) {startPoint.x + length - 1, startPoint.y});
+            draw_figure_triangleFilled(
+                    (coordinatePoint_t) {
+                            startPoint.x + length - 2,
+                            startPoint.y - 2
+                    },
+                    (coordinatePoint_t) {
+                            startPoint.x + length - 2,
+                            startPoint.y + 2
+                    },
+                    (coordinatePoint_t) {
+                            startPoint.x + length,
+                            startPoint.y
+                    }
+            );
+            break;
         case DRAW_ARROW_OUTLINE:
             draw_figure_triangleOutline(
                     (coordinatePoint_t) {
@@ -157,7 +187,18 @@ void draw_figure_arrowVertical(coordinatePoint_t startPoint, uint8_t length, dra
             //draw no arrow
             break;
         case DRAW_ARROW_FILLED:
-            draw_figure_dotSmall((coordinatePoint_t) {startPoint.x, startPoint.y + 1});
+            draw_figure_triangleFilled(
+                    startPoint,
+                    (coordinatePoint_t) {
+                            startPoint.x + 2,
+                            startPoint.y + 2
+                    },
+                    (coordinatePoint_t) {
+                            startPoint.x - 2,
+                            startPoint.y + 2
+                    }
+            );
+            break;
         case DRAW_ARROW_OUTLINE:
             draw_figure_triangleOutline(
                     startPoint,
@@ -180,7 +221,21 @@ void draw_figure_arrowVertical(coordinatePoint_t startPoint, uint8_t length, dra
             //draw no arrow
             break;
         case DRAW_ARROW_FILLED:
-            draw_figure_dotSmall((coordinatePoint_t) {startPoint.x, startPoint.y + length - 1});
+            draw_figure_triangleFilled(
+                    (coordinatePoint_t) {
+                            startPoint.x - 2,
+                            startPoint.y + length - 2
+                    },
+                    (coordinatePoint_t) {
+                            startPoint.x + 2,
+                            startPoint.y + length - 2
+                    },
+                    (coordinatePoint_t) {
+                            startPoint.x,
+                            startPoint.y + length
+                    }
+            );
+            break;
         case DRAW_ARROW_OUTLINE:
             draw_figure_triangleOutline(
                     (coordinatePoint_t) {
@@ -36,12 +36,10 @@
  * #####################################################################################################################
  */
 
-//TODO: Implement big lines
-
 #ifndef MCU_DRAWINGDOTSANDLINES_H
 #define MCU_DRAWINGDOTSANDLINES_H
 
-#include <avr/io.h>
+#include "../../sys_src/platform.h"
 #include "drawingUtilities.h"
 
 /*******************************************************************************
@@ -124,6 +122,17 @@ void draw_figure_lineVertical(coordinatePoint_t startPoint, uint8_t length, draw
  */
 void draw_figure_lineCoordinates(coordinatePoint_t startPoint, coordinatePoint_t endPoint, draw_figure_line_t type);
 
+/*! @brief draw a thick line with angle
+ *
+ * @param startPoint    coordinate point to start the line
+ * @param endPoint      coordinate point to end the line
+ * @param width         width in pixel of the line
+ *
+ * This function draws a filled line of the given width centered on the line from start_point to end_point. A width of
+ * 1 is the same as the filled 1px line.
+ */
+void draw_figure_lineThick(coordinatePoint_t startPoint, coordinatePoint_t endPoint, uint8_t width);
+
 /*******************************************************************************
  * arrows
  ******************************************************************************/
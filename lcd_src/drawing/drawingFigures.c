@@ -78,6 +78,28 @@ void draw_figure_rectangleOutline(coordinatePoint_t startPoint, coordinatePoint_
     draw_figure_lineVertical(rightTop, (endPoint.y - startPoint.y) + 1, DRAW_LINE_FILLED);
 }
 
+void draw_figure_rectangleOutlineThick(coordinatePoint_t startPoint, coordinatePoint_t endPoint, uint8_t width) {
+    draw_figure_turnCoordinatePoints(&startPoint, &endPoint);
+
+    dogmGraphic_drawRectangleStroke(startPoint.x, startPoint.y, (endPoint.x - startPoint.x) + 1,
+                                    (endPoint.y - startPoint.y) + 1, width);
+}
+
+void draw_figure_roundedRectangleFilled(coordinatePoint_t startPoint, coordinatePoint_t endPoint, uint8_t radius) {
+    draw_figure_turnCoordinatePoints(&startPoint, &endPoint);
+
+    dogmGraphic_drawRoundedRectangle(startPoint.x, startPoint.y, (endPoint.x - startPoint.x) + 1,
+                                     (endPoint.y - startPoint.y) + 1, radius, 1);
+}
+
+void draw_figure_roundedRectangleOutline(coordinatePoint_t startPoint, coordinatePoint_t endPoint, uint8_t radius,
+                                         uint8_t width) {
+    draw_figure_turnCoordinatePoints(&startPoint, &endPoint);
+
+    dogmGraphic_drawRoundedRectangleStroke(startPoint.x, startPoint.y, (endPoint.x - startPoint.x) + 1,
+                                           (endPoint.y - startPoint.y) + 1, radius, width);
+}
+
 void draw_figure_circleFilled(coordinatePoint_t middle, uint8_t radius) {
     dogmGraphic_drawCircleOutline(middle.x, middle.y, radius, 1);
 }
@@ -86,6 +108,30 @@ void draw_figure_circleOutline(coordinatePoint_t middle, uint8_t radius) {
     dogmGraphic_drawCircleOutline(middle.x, middle.y, radius, 0);
 }
 
+void draw_figure_circleOutlineThick(coordinatePoint_t middle, uint8_t radius, uint8_t width) {
+    dogmGraphic_drawCircleStroke(middle.x, middle.y, radius, width);
+}
+
+void draw_figure_arc(coordinatePoint_t middle, uint8_t radius, int16_t startAngle, int16_t endAngle, uint8_t width) {
+    dogmGraphic_drawArc(middle.x, middle.y, radius, startAngle, endAngle, width);
+}
+
+void draw_figure_pie(coordinatePoint_t middle, uint8_t radius, int16_t startAngle, int16_t endAngle) {
+    dogmGraphic_drawPie(middle.x, middle.y, radius, startAngle, endAngle);
+}
+
+void draw_figure_ellipseFilled(coordinatePoint_t middle, uint8_t radius_x, uint8_t radius_y) {
+    dogmGraphic_drawEllipse(middle.x, middle.y, radius_x, radius_y, 1);
+}
+
+void draw_figure_ellipseOutline(coordinatePoint_t middle, uint8_t radius_x, uint8_t radius_y) {
+    dogmGraphic_drawEllipse(middle.x, middle.y, radius_x, radius_y, 0);
+}
+
+void draw_figure_ellipseOutlineThick(coordinatePoint_t middle, uint8_t radius_x, uint8_t radius_y, uint8_t width) {
+    dogmGraphic_drawEllipseStroke(middle.x, middle.y, radius_x, radius_y, width);
+}
+
 void draw_figure_triangleOutline(coordinatePoint_t coordinateA, coordinatePoint_t coordinateB,
                                  coordinatePoint_t coordinateC) {
     draw_figure_lineCoordinates(coordinateA, coordinateB, DRAW_LINE_FILLED);
@@ -93,11 +139,22 @@ void draw_figure_triangleOutline(coordinatePoint_t coordinateA, coordinatePoint_
     draw_figure_lineCoordinates(coordinateC, coordinateA, DRAW_LINE_FILLED);
 }
 
+void draw_figure_triangleFilled(coordinatePoint_t coordinateA, coordinatePoint_t coordinateB,
+                                coordinatePoint_t coordinateC) {
+    dogmGraphic_drawTriangle(coordinateA.x, coordinateA.y, coordinateB.x, coordinateB.y, coordinateC.x, coordinateC.y,
+                             DOGM_ADD);
+}
+
+void draw_figure_polygonFilled(const coordinatePoint_t *points, uint8_t count) {
+    dogmGraphic_drawPolygon(points, count, DOGM_ADD);
+}
+
 void draw_figure_image(coordinatePoint_t startPoint, imageData_t data, uint8_t clean, dogmGraphic_drawType_t type) {
     if (clean || (type == DOGM_CLEAR)) {
         // clean area
         dogmGraphic_drawArea(startPoint.x, startPoint.y, data.width, data.height, DOGM_CLEAR);
     }
 
-    dogmGraphic_drawP(startPoint.x, startPoint.y, data.width, data.height, type, data.datapath);
+    const dogmGraphic_bitmap_t source = {data.datapath, data.width, data.height, DOGM_MEMORY_PROGMEM, data.format};
+    dogmGraphic_blit(startPoint.x, startPoint.y, &source, 0, 0, data.width, data.height, type);
 }
\ No newline at end of file
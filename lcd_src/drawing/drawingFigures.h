@@ -36,15 +36,10 @@
  * #####################################################################################################################
  */
 
-//TODO: Implement Triangle filled function
-//TODO: Implement Elipse outline function
-//TODO: Implement Elipse filled function
-//TODO: Implement Circle arcs function with angles
-
 #ifndef MCU_DRAWINGFIGURES_H
 #define MCU_DRAWINGFIGURES_H
 
-#include <avr/pgmspace.h>
+#include "../../sys_src/platform.h"
 
 #include "drawingDotsAndLines.h"
 #include "../dogm128-graphic.h"
@@ -101,6 +96,34 @@ void draw_figure_rectangleFilled(coordinatePoint_t startPoint, coordinatePoint_t
  */
 void draw_figure_rectangleOutline(coordinatePoint_t startPoint, coordinatePoint_t endPoint);
 
+/*! @brief draw a outline rectangle with a thick border
+ *
+ * @param startPoint    first point top left of drawing area
+ * @param endPoint      second point low right of drawing area
+ * @param width         width in pixel of the border
+ *
+ * The border grows to the inside, the outer size stays the given area.
+ */
+void draw_figure_rectangleOutlineThick(coordinatePoint_t startPoint, coordinatePoint_t endPoint, uint8_t width);
+
+/*! @brief draw a 100% filled rectangle with rounded corners
+ *
+ * @param startPoint    first point top left of drawing area
+ * @param endPoint      second point low right of drawing area
+ * @param radius        corner radius
+ */
+void draw_figure_roundedRectangleFilled(coordinatePoint_t startPoint, coordinatePoint_t endPoint, uint8_t radius);
+
+/*! @brief draw a outline rectangle with rounded corners
+ *
+ * @param startPoint    first point top left of drawing area
+ * @param endPoint      second point low right of drawing area
+ * @param radius        corner radius
+ * @param width         width in pixel of the border, growing to the inside
+ */
+void draw_figure_roundedRectangleOutline(coordinatePoint_t startPoint, coordinatePoint_t endPoint, uint8_t radius,
+                                         uint8_t width);
+
 /*! @brief draw a 100% filled circle
  *
  * @param middle    coordinate point in the middle of the circle
@@ -121,6 +144,60 @@ void draw_figure_circleFilled(coordinatePoint_t middle, uint8_t radius);
  */
 void draw_figure_circleOutline(coordinatePoint_t middle, uint8_t radius);
 
+/*! @brief draw a outline circle with a thick border
+ *
+ * @param middle    coordinate point in the middle of the circle
+ * @param radius    space from the middle to the outline of a circle
+ * @param width     width in pixel of the border, growing to the inside
+ */
+void draw_figure_circleOutlineThick(coordinatePoint_t middle, uint8_t radius, uint8_t width);
+
+/*! @brief draw an arc
+ *
+ * @param middle        coordinate point in the middle of the circle
+ * @param radius        outer radius of the arc
+ * @param startAngle    first angle in degree, 0 is to the right and the angles grow counterclockwise
+ * @param endAngle      last angle in degree
+ * @param width         width in pixel of the arc, growing to the inside
+ */
+void draw_figure_arc(coordinatePoint_t middle, uint8_t radius, int16_t startAngle, int16_t endAngle, uint8_t width);
+
+/*! @brief draw a 100% filled pie segment
+ *
+ * @param middle        coordinate point in the middle of the circle
+ * @param radius        radius of the pie
+ * @param startAngle    first angle in degree, 0 is to the right and the angles grow counterclockwise
+ * @param endAngle      last angle in degree
+ */
+void draw_figure_pie(coordinatePoint_t middle, uint8_t radius, int16_t startAngle, int16_t endAngle);
+
+/*! @brief draw a 100% filled ellipse
+ *
+ * @param middle    coordinate point in the middle of the ellipse
+ * @param radius_x  horizontal space from the middle to the outline
+ * @param radius_y  vertical space from the middle to the outline
+ */
+void draw_figure_ellipseFilled(coordinatePoint_t middle, uint8_t radius_x, uint8_t radius_y);
+
+/*! @brief draw a outline ellipse
+ *
+ * @param middle    coordinate point in the middle of the ellipse
+ * @param radius_x  horizontal space from the middle to the outline
+ * @param radius_y  vertical space from the middle to the outline
+ *
+ * The space inside the ellipse won't be changed.
+ */
+void draw_figure_ellipseOutline(coordinatePoint_t middle, uint8_t radius_x, uint8_t radius_y);
+
+/*! @brief draw a outline ellipse with a thick border
+ *
+ * @param middle    coordinate point in the middle of the ellipse
+ * @param radius_x  horizontal space from the middle to the outline
+ * @param radius_y  vertical space from the middle to the outline
+ * @param width     width in pixel of the border, growing to the inside
+ */
+void draw_figure_ellipseOutlineThick(coordinatePoint_t middle, uint8_t radius_x, uint8_t radius_y, uint8_t width);
+
 /*! @brief draw a triangle outline
  *
  * @param coordinateA   math coordinate point A of triangle
@@ -133,6 +210,27 @@ void draw_figure_circleOutline(coordinatePoint_t middle, uint8_t radius);
 void draw_figure_triangleOutline(coordinatePoint_t coordinateA, coordinatePoint_t coordinateB,
                                  coordinatePoint_t coordinateC);
 
+/*! @brief draw a 100% filled triangle
+ *
+ * @param coordinateA   math coordinate point A of triangle
+ * @param coordinateB   math coordinate point B of triangle
+ * @param coordinateC   math coordinate point C of triangle
+ *
+ * This function fills the triangle given with the outline coordinate points A,B and C including its outline. The
+ * triangle can be drawn in every angle position.
+ */
+void draw_figure_triangleFilled(coordinatePoint_t coordinateA, coordinatePoint_t coordinateB,
+                                coordinatePoint_t coordinateC);
+
+/*! @brief draw a 100% filled convex polygon
+ *
+ * @param points    outline coordinate points in drawing order
+ * @param count     number of points
+ *
+ * This function fills a convex polygon like a needle or an icon including its outline.
+ */
+void draw_figure_polygonFilled(const coordinatePoint_t *points, uint8_t count);
+
 /*******************************************************************************
  * draw persistent data
  ******************************************************************************/
@@ -142,15 +240,18 @@ void draw_figure_triangleOutline(coordinatePoint_t coordinateA, coordinatePoint_
  * @param datapath  repesent the first flash adress of the drawn data
  * @param width     width in pixel of the given data
  * @param height    height in pixel of the given data
+ * @param format    format of the data; @see dogmGraphic_bitmapFormat_t
  *
  * This struct represents data information of a specific place in the flash data. For example the place of a logo witch
- * should be drawn on the screen. Therefore the data address, the width and height are necessary.
+ * should be drawn on the screen. Therefore the data address, the width and height are necessary. The format may be left
+ * out for raw page data, a big image like a splash screen can be stored run length encoded instead.
  */
 
 typedef struct {
     PGM_VOID_P datapath;
     uint8_t width;
     uint8_t height;
+    dogmGraphic_bitmapFormat_t format;
 } imageData_t;
 
 /*! @brief draw a data block from flash
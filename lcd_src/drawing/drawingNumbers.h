@@ -39,7 +39,7 @@
 #ifndef MCU_DRAWINGNUMBERS_H
 #define MCU_DRAWINGNUMBERS_H
 
-#include <avr/io.h>
+#include "../../sys_src/platform.h"
 #include "../dogm128-graphic.h"
 #include "drawingUtilities.h"
 
@@ -34,7 +34,7 @@
 // TODO make a difference between inverted (what is done here) and invert, where "invert" is an XOR with the font
 // See line 61
 
-#include <avr/io.h>
+#include "../../sys_src/platform.h"
 #include "drawingText.h"
 #include "drawingFigures.h"
 
@@ -85,7 +85,8 @@ uint8_t draw_font_char(dogmGraphic_drawType_t type, char letter) {
             (imageData_t) {
                     draw_font_actualFont->data_font + (delta * (draw_font_actualFont->char_height >> 3)), //divide by 8
                     width,
-                    draw_font_actualFont->char_height
+                    draw_font_actualFont->char_height,
+                    DOGM_BITMAP_RAW
             },
             0,
             type
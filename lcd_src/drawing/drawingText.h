@@ -45,7 +45,7 @@
 #ifndef MCU_DRAWINGFONTS_H
 #define MCU_DRAWINGFONTS_H
 
-#include <avr/pgmspace.h>
+#include "../../sys_src/platform.h"
 #include "../dogm128-graphic.h"
 #include "drawingUtilities.h"
 
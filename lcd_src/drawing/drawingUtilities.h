@@ -37,8 +37,7 @@
 #ifndef MCU_DRAWINGUTILITIES_H
 #define MCU_DRAWINGUTILITIES_H
 
-#include <avr/io.h>
-#include <avr/pgmspace.h>
+#include "../../sys_src/platform.h"
 
 /*******************************************************************************
  * coordinate system
@@ -105,9 +104,10 @@ typedef enum FontAlignment {
 
 /*! @brief actual font infos
  *
- * This pointer stores the actual font with all its infos. Every function uses this font to draw its chars.
+ * This pointer stores the actual font with all its infos. Every function uses this font to draw its chars. Every
+ * display has its own font, this name belongs to the display bound with dogmGraphic_bind.
  */
-const fontData_t* draw_font_actualFont;
+#define draw_font_actualFont    (dogmGraphic_display->font)
 
 /*! @brief cursor infos
  *
@@ -124,9 +124,9 @@ typedef struct Cursor {
 /*!
  * @brief actual cursor in ram
  *
- * This value stores the actual used cursor.
+ * This value stores the actual used cursor of the display bound with dogmGraphic_bind.
  */
-cursor_t draw_font_actualCursor;
+#define draw_font_actualCursor  (dogmGraphic_display->cursor)
 
 /*! @brief sets the cursor
  *
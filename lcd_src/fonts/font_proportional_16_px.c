@@ -5,7 +5,7 @@
 	//16px
 */
 
-#include <avr/pgmspace.h>
+#include "../../sys_src/platform.h"
 #include "../drawing/drawingText.h"
 
 const uint8_t font_proportional_16px_data[] PROGMEM = {
@@ -12,7 +12,7 @@
     Font bits per pixel : 1
 */
 
-#include <avr/pgmspace.h>
+#include "../../sys_src/platform.h"
 #include "../drawing/drawingText.h"
 
 const uint8_t font_proportional_8px_data[] PROGMEM = {
@@ -0,0 +1,62 @@
+/*! @file dogm128-hal-avr.h
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+#ifndef MCU_DOGM128_HAL_AVR_H
+#define MCU_DOGM128_HAL_AVR_H
+
+#include "../../sys_src/platform.h"
+#include "../../sys_src/iodef.h"
+
+#define DOGM_PINS_DEFAULT       {&DISPPORT, (1 << DISPCS), (1 << DISPA0)}
+
+// the data direction register is always the register in front of the port register
+#define DOGM_SET_DDR()          DISPDDR |= (1<<DISPRESET);\
+                                *(dogm_pins->port - 1) |= dogm_pins->select | dogm_pins->data
+#define DOGM_SET_DDR_SPI()      DISPDDR |= (1 << DISPMOSI) | (1 << DISPSCK)
+#define DOGM_INIT_SPI()         SPCR = (1 << SPE) | (1 << MSTR) | (1 << CPOL) | (1 << CPHA);\
+                                SPSR = (1 << SPI2X);
+#define DOGM_SELECT()           *dogm_pins->port &= (uint8_t) ~dogm_pins->select
+#define DOGM_UNSELECT()         *dogm_pins->port |= dogm_pins->select
+#define DOGM_COMMAND()          *dogm_pins->port &= (uint8_t) ~dogm_pins->data
+#define DOGM_DATA()             *dogm_pins->port |= dogm_pins->data
+#define DOGM_RESET()            DISPPORT &= ~(1<<DISPRESET)
+#define DOGM_RUN()              DISPPORT |= (1<<DISPRESET); SPSR |= (1 << SPIF)
+
+#define DOGM_SPI_WRITE(byte)    SPDR = (byte)
+#define DOGM_BUSY_WAITING()     while(!(SPSR & (1<<SPIF)));
+#define DOGM_SPI_CLEAR_FLAG()   (void) SPSR; (void) SPDR
+#define DOGM_SPI_ISR            SPI_STC_vect
+#define DOGM_SPI_INT_ENABLE()   SPCR |= (1 << SPIE)
+#define DOGM_SPI_INT_DISABLE()  SPCR &= ~(1 << SPIE)
+#define DOGM_SPI_INT_WAIT()
+
+#define DOGM_DELAY_MS(ms)       PLATFORM_DELAY_MS(ms)
+
+#endif //MCU_DOGM128_HAL_AVR_H
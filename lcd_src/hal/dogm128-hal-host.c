@@ -0,0 +1,140 @@
+/*! @file dogm128-hal-host.c
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+#include "dogm128-hal.h"
+
+#if PLATFORM_HOST
+
+#include <stddef.h>
+
+volatile dogmHost_pins_t dogmHost_pins = {0, 0, 0, 0, 0, 1};
+volatile uint8_t dogmHost_port = 0xFF;
+
+static dogmHost_byte_t dogmHost_bytes[DOGM_HOST_RECORD_SIZE];
+static uint16_t dogmHost_count;
+static uint32_t dogmHost_lost;
+static dogmHost_listener_t dogmHost_listener;
+
+/*! @brief record one byte
+ *
+ * @param type      type of the byte
+ * @param value     byte on the wire
+ *
+ * This internal function puts the byte into the recording and gives it to the listener.
+ */
+static void dogmHost_receive(dogmHost_type_t type, uint8_t value) {
+    if (dogmHost_count < DOGM_HOST_RECORD_SIZE) {
+        dogmHost_bytes[dogmHost_count].type = type;
+        dogmHost_bytes[dogmHost_count].value = value;
+        dogmHost_bytes[dogmHost_count].port = dogmHost_port;
+        dogmHost_count++;
+    }
+    else {
+        dogmHost_lost++;
+    }
+
+    if (dogmHost_listener != NULL) {
+        dogmHost_listener(type, value);
+    }
+}
+
+void dogmHost_clear(void) {
+    dogmHost_count = 0;
+    dogmHost_lost = 0;
+}
+
+uint16_t dogmHost_recordCount(void) {
+    return dogmHost_count;
+}
+
+const dogmHost_byte_t* dogmHost_record(void) {
+    return dogmHost_bytes;
+}
+
+uint32_t dogmHost_lostBytes(void) {
+    return dogmHost_lost;
+}
+
+void dogmHost_setListener(dogmHost_listener_t listener) {
+    dogmHost_listener = listener;
+}
+
+void dogmHost_runInterrupts(void) {
+    while (dogmHost_pins.interruptEnabled && dogmHost_pins.transferComplete) {
+        // the hardware clears the flag, when the interrupt routine is started
+        dogmHost_pins.transferComplete = 0;
+        dogmHost_spiIsr();
+    }
+}
+
+void dogmHost_initSpi(void) {
+    dogmHost_pins.spiEnabled = 1;
+}
+
+void dogmHost_select(uint8_t active) {
+    if (active) {
+        dogmHost_port &= (uint8_t) ~dogm_pins->select;
+    }
+    else {
+        dogmHost_port |= dogm_pins->select;
+    }
+    dogmHost_pins.select = active;
+}
+
+void dogmHost_setData(uint8_t data) {
+    if (data) {
+        dogmHost_port |= dogm_pins->data;
+    }
+    else {
+        dogmHost_port &= (uint8_t) ~dogm_pins->data;
+    }
+    dogmHost_pins.data = data;
+}
+
+void dogmHost_setReset(uint8_t active) {
+    if (active && !dogmHost_pins.reset) {
+        dogmHost_receive(DOGM_HOST_RESET, 0);
+    }
+    dogmHost_pins.reset = active;
+}
+
+void dogmHost_spiWrite(uint8_t byte) {
+    if (dogmHost_pins.spiEnabled && dogmHost_pins.select && !dogmHost_pins.reset) {
+        dogmHost_receive(dogmHost_pins.data ? DOGM_HOST_DATA : DOGM_HOST_COMMAND, byte);
+    }
+    else {
+        dogmHost_lost++;
+    }
+
+    // the byte is on the wire at once
+    dogmHost_pins.transferComplete = 1;
+}
+
+#endif
@@ -0,0 +1,175 @@
+/*! @file dogm128-hal-host.h
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+#ifndef MCU_DOGM128_HAL_HOST_H
+#define MCU_DOGM128_HAL_HOST_H
+
+#include <stdint.h>
+#include "../../sys_src/platform.h"
+
+/*! @brief number of recorded bytes
+ *
+ * More bytes are not recorded, but still given to the listener and counted with dogmHost_lostBytes.
+ */
+#define DOGM_HOST_RECORD_SIZE   8192
+
+/*! @brief type of a recorded byte
+ *
+ * @param DOGM_HOST_COMMAND     byte sent with A0 low
+ * @param DOGM_HOST_DATA        byte sent with A0 high
+ * @param DOGM_HOST_RESET       reset line activated, the value is always 0
+ */
+typedef enum {
+    DOGM_HOST_COMMAND = 0,
+    DOGM_HOST_DATA,
+    DOGM_HOST_RESET
+} dogmHost_type_t;
+
+/*! @brief one recorded byte
+ *
+ * @param type      command, data or reset
+ * @param value     byte on the wire
+ * @param port      virtual port with all chip selects, when the byte was sent
+ */
+typedef struct {
+    dogmHost_type_t type;
+    uint8_t value;
+    uint8_t port;
+} dogmHost_byte_t;
+
+/*! @brief listener for every byte the display receives
+ *
+ * A listener can decode the stream at once, e.g. a controller emulator.
+ */
+typedef void (*dogmHost_listener_t)(dogmHost_type_t type, uint8_t value);
+
+/*! @brief virtual pins and SPI of the host
+ *
+ * @param select            chip select active
+ * @param data              A0 high
+ * @param reset             reset line active
+ * @param spiEnabled        SPI set up by DOGM_INIT_SPI
+ * @param interruptEnabled  transfer complete interrupt enabled
+ * @param transferComplete  transfer complete flag, set by every written byte at once
+ */
+typedef struct {
+    uint8_t select;
+    uint8_t data;
+    uint8_t reset;
+    uint8_t spiEnabled;
+    uint8_t interruptEnabled;
+    uint8_t transferComplete;
+} dogmHost_pins_t;
+
+extern volatile dogmHost_pins_t dogmHost_pins;
+
+/*! @brief virtual port of CS and A0
+ *
+ * All pins are high after the start. DOGM_PINS_DEFAULT uses bit 0 as chip select and bit 1 as A0, further displays
+ * can use the other bits.
+ */
+extern volatile uint8_t dogmHost_port;
+
+/*! @brief clear the recording
+ *
+ * This function removes all recorded bytes and resets the counter of lost bytes. The pins are not changed.
+ */
+void dogmHost_clear(void);
+
+/*! @brief number of recorded bytes
+ *
+ * @return  number of bytes in dogmHost_record
+ */
+uint16_t dogmHost_recordCount(void);
+
+/*! @brief recorded bytes
+ *
+ * @return  all bytes received by the display since the last dogmHost_clear, in the order of the wire
+ */
+const dogmHost_byte_t* dogmHost_record(void);
+
+/*! @brief lost bytes
+ *
+ * @return  number of bytes written without chip select or behind the end of the recording
+ */
+uint32_t dogmHost_lostBytes(void);
+
+/*! @brief set the listener
+ *
+ * @param listener  function called for every received byte; NULL removes the listener
+ */
+void dogmHost_setListener(dogmHost_listener_t listener);
+
+/*! @brief serve the SPI interrupt
+ *
+ * The host has no real interrupts. This function calls the transfer complete interrupt routine again and again,
+ * as long as it is enabled and a transfer is complete. So a started asynchronous flush is completely sent afterwards.
+ */
+void dogmHost_runInterrupts(void);
+
+void dogmHost_initSpi(void);
+
+void dogmHost_select(uint8_t active);
+
+void dogmHost_setData(uint8_t data);
+
+void dogmHost_setReset(uint8_t active);
+
+void dogmHost_spiWrite(uint8_t byte);
+
+/*! @brief transfer complete interrupt routine
+ *
+ * This function is defined by the driver with PLATFORM_ISR(DOGM_SPI_ISR).
+ */
+void dogmHost_spiIsr(void);
+
+#define DOGM_PINS_DEFAULT       {&dogmHost_port, 0x01, 0x02}
+
+#define DOGM_SET_DDR()
+#define DOGM_SET_DDR_SPI()
+#define DOGM_INIT_SPI()         dogmHost_initSpi()
+#define DOGM_SELECT()           dogmHost_select(1)
+#define DOGM_UNSELECT()         dogmHost_select(0)
+#define DOGM_COMMAND()          dogmHost_setData(0)
+#define DOGM_DATA()             dogmHost_setData(1)
+#define DOGM_RESET()            dogmHost_setReset(1)
+#define DOGM_RUN()              dogmHost_setReset(0)
+
+#define DOGM_SPI_WRITE(byte)    dogmHost_spiWrite(byte)
+#define DOGM_BUSY_WAITING()     while(!dogmHost_pins.transferComplete);
+#define DOGM_SPI_CLEAR_FLAG()   dogmHost_pins.transferComplete = 0
+#define DOGM_SPI_ISR            dogmHost_spiIsr
+#define DOGM_SPI_INT_ENABLE()   dogmHost_pins.interruptEnabled = 1
+#define DOGM_SPI_INT_DISABLE()  dogmHost_pins.interruptEnabled = 0
+#define DOGM_SPI_INT_WAIT()     dogmHost_runInterrupts()
+
+#define DOGM_DELAY_MS(ms)       PLATFORM_DELAY_MS(ms)
+
+#endif //MCU_DOGM128_HAL_HOST_H
@@ -0,0 +1,88 @@
+/*! @file dogm128-hal.h
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+#ifndef MCU_DOGM128_HAL_H
+#define MCU_DOGM128_HAL_H
+
+/*! @brief transport of the display
+ *
+ * Every backend defines the same abbreviations for the SPI, the pins CS, A0 and RESET and the delays:
+ *
+ * DOGM_PINS_DEFAULT        initializer of dogm_pins_t for the display of sys_src/iodef.h
+ * DOGM_SET_DDR()           set the pins CS, A0 and RESET as outputs
+ * DOGM_SET_DDR_SPI()       set the pins MOSI and SCK as outputs
+ * DOGM_INIT_SPI()          setup the SPI as master for the display
+ * DOGM_SELECT()            activate the chip select
+ * DOGM_UNSELECT()          release the chip select
+ * DOGM_COMMAND()           set A0 for commands
+ * DOGM_DATA()              set A0 for display data
+ * DOGM_RESET()             activate the reset line
+ * DOGM_RUN()               release the reset line
+ * DOGM_SPI_WRITE(byte)     put one byte on the wire, it is sent in the background
+ * DOGM_BUSY_WAITING()      wait until the last byte is completely sent
+ * DOGM_SPI_CLEAR_FLAG()    clear a stale transfer complete flag
+ * DOGM_SPI_ISR             vector of the transfer complete interrupt, used with PLATFORM_ISR
+ * DOGM_SPI_INT_ENABLE()    enable the transfer complete interrupt
+ * DOGM_SPI_INT_DISABLE()   disable the transfer complete interrupt
+ * DOGM_SPI_INT_WAIT()      wait for the next transfer complete interrupt of a running asynchronous flush
+ * DOGM_DELAY_MS(ms)        wait some milliseconds
+ *
+ * The burst functions of dogm128.c are built on these byte primitives, so a backend does not need its own burst. CS and
+ * A0 are taken from dogm_pins, so several displays can share the SPI and the RESET line.
+ */
+
+#include <stdint.h>
+#include "../../sys_src/platform.h"
+
+/*! @brief chip select and A0 of one display
+ *
+ * @param port      output register of both pins
+ * @param select    bit mask of the chip select, low active
+ * @param data      bit mask of A0, high for display data
+ */
+typedef struct {
+    volatile uint8_t *port;
+    uint8_t select;
+    uint8_t data;
+} dogm_pins_t;
+
+/*! @brief pins of the actual display
+ *
+ * Every abbreviation for CS and A0 uses these pins. dogmGraphic_bind sets them together with the ram copy.
+ */
+extern const dogm_pins_t *dogm_pins;
+
+#if PLATFORM_HOST
+#include "dogm128-hal-host.h"
+#else
+#include "dogm128-hal-avr.h"
+#endif
+
+#endif //MCU_DOGM128_HAL_H
@@ -3,7 +3,7 @@
  * date: 10.6.16
  */
 
-#include <avr/pgmspace.h>
+#include "../../sys_src/platform.h"
 #include "../drawing/drawingFigures.h"
 
 // width = 16
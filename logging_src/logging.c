@@ -29,12 +29,14 @@
  * #####################################################################################################################
  */
 
-#include <avr/pgmspace.h>
+#include "../sys_src/platform.h"
 #include <stdlib.h>
 
 #include "logging.h"
 #include "stream.h"
 
+logLevel_t logLevelIntern;
+
 void printString(char* string, uint8_t errorStream);
 
 void printString_P(const char* string, uint8_t errorStream);
@@ -32,7 +32,7 @@
 #ifndef MCU_LOGGING_H
 #define MCU_LOGGING_H
 
-#include <avr/io.h>
+#include "../sys_src/platform.h"
 
 typedef enum {
     LOG_DEBUG = 0,
@@ -42,7 +42,7 @@ typedef enum {
     LOG_FATAL_ERROR
 } logLevel_t;
 
-logLevel_t logLevelIntern;
+extern logLevel_t logLevelIntern;
 
 void logging_init(logLevel_t logLevel);
 
@@ -30,6 +30,16 @@
  */
 
 #include "stream.h"
+#include "../sys_src/platform.h"
+
+#if PLATFORM_HOST
+
+void stream_init(void) {
+    // stdin, stdout and stderr are the console of the host already
+}
+
+#else
+
 #include "uart.h"
 
 static int uart_putCharStream(char c, FILE* stream);
@@ -52,3 +62,5 @@ void stream_init(void) {
     stdout = &stdUART;
     stderr = &stdUART;
 }
+
+#endif
@@ -0,0 +1,105 @@
+/*! @file platform-host.c
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+#include "platform.h"
+
+#if PLATFORM_HOST
+
+static uint32_t platform_delayedMsSum;
+
+void platform_delayMs(uint16_t ms) {
+    platform_delayedMsSum += ms;
+}
+
+uint32_t platform_delayedMs(void) {
+    return platform_delayedMsSum;
+}
+
+/*! @brief convert unsigned number to string
+ *
+ * @param value     number
+ * @param string    destination, big enough for all digits and the sign
+ * @param base      base between 2 and 36
+ * @param negative  put a minus sign in front
+ *
+ * This internal function works like the conversion functions of avr-libc. Letters are written in lower case.
+ */
+static char* platform_toString(unsigned long value, char* string, int base, uint8_t negative) {
+    char* pos = string;
+    if ((base < 2) || (base > 36)) {
+        *pos = 0;
+        return string;
+    }
+
+    if (negative) {
+        *pos++ = '-';
+    }
+
+    char* digits = pos;
+    do {
+        uint8_t digit = (uint8_t) (value % (unsigned long) base);
+        *pos++ = (char) ((digit < 10) ? ('0' + digit) : ('a' + digit - 10));
+        value /= (unsigned long) base;
+    } while (value);
+    *pos = 0;
+
+    // digits are written from the lowest one, so reverse them
+    for (pos--; digits < pos; digits++, pos--) {
+        char swap = *digits;
+        *digits = *pos;
+        *pos = swap;
+    }
+    return string;
+}
+
+char* itoa(int value, char* string, int base) {
+    // like avr-libc, only base 10 has a sign
+    if ((value < 0) && (base == 10)) {
+        return platform_toString((unsigned long) -(long) value, string, base, 1);
+    }
+    return platform_toString((unsigned int) value, string, base, 0);
+}
+
+char* utoa(unsigned int value, char* string, int base) {
+    return platform_toString(value, string, base, 0);
+}
+
+char* ltoa(long value, char* string, int base) {
+    if ((value < 0) && (base == 10)) {
+        return platform_toString(0UL - (unsigned long) value, string, base, 1);
+    }
+    return platform_toString((unsigned long) value, string, base, 0);
+}
+
+char* ultoa(unsigned long value, char* string, int base) {
+    return platform_toString(value, string, base, 0);
+}
+
+#endif
@@ -0,0 +1,109 @@
+/*! @file platform.h
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+#ifndef MCU_PLATFORM_H
+#define MCU_PLATFORM_H
+
+/*! @brief build for the host instead of the AVR
+ *
+ * 1 = build for a native host, e.g. unit tests and benchmarks on a Linux machine. Flash reads become normal reads,
+ * interrupt routines become normal functions and delays are only counted.
+ * 0 = build for the AVR with avr-libc.
+ */
+#ifndef PLATFORM_HOST
+#define PLATFORM_HOST           0
+#endif
+
+#if PLATFORM_HOST
+
+#include <stdint.h>
+
+// Flash reads, the host has only one address space
+
+#define PROGMEM
+#define PSTR(s)                 (s)
+#define PGM_P                   const char*
+#define PGM_VOID_P              const void*
+#define pgm_read_byte(addr)     (*(const uint8_t*) (addr))
+#define pgm_read_word(addr)     (*(const uint16_t*) (addr))
+
+// Interrupts
+
+#define PLATFORM_ISR(vector)    void vector(void)
+#define sei()
+#define cli()
+
+// Atomic blocks of util/atomic.h, the host interrupt routines are only called by the main loop
+
+#define ATOMIC_RESTORESTATE
+#define ATOMIC_BLOCK(type)      for (uint8_t platform_atomicOnce = 1; platform_atomicOnce; platform_atomicOnce = 0)
+
+// Delays
+
+#define PLATFORM_DELAY_MS(ms)   platform_delayMs(ms)
+
+/*! @brief count a delay
+ *
+ * @param ms    delay in milliseconds
+ *
+ * The host does not wait at all. The delays are only summed up, see platform_delayedMs.
+ */
+void platform_delayMs(uint16_t ms);
+
+/*! @brief sum of all delays
+ *
+ * @return  milliseconds waited with PLATFORM_DELAY_MS since the start
+ */
+uint32_t platform_delayedMs(void);
+
+// Number conversion of avr-libc, missing in the host libc
+
+char* itoa(int value, char* string, int base);
+
+char* utoa(unsigned int value, char* string, int base);
+
+char* ltoa(long value, char* string, int base);
+
+char* ultoa(unsigned long value, char* string, int base);
+
+#else
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include <util/delay.h>
+
+#define PLATFORM_ISR(vector)    ISR(vector)
+#define PLATFORM_DELAY_MS(ms)   _delay_ms(ms)
+
+#endif
+
+#endif //MCU_PLATFORM_H
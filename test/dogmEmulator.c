@@ -0,0 +1,186 @@
+/*! @file dogmEmulator.c
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+#include <string.h>
+#include "dogmEmulator.h"
+#include "../lcd_src/dogm128-graphic.h"
+
+static dogmEmu_state_t dogmEmu;
+static dogmEmu_counter_t dogmEmu_counter;
+
+void dogmEmu_attach(void) {
+    dogmEmu_reset();
+    dogmHost_setListener(dogmEmu_receive);
+}
+
+void dogmEmu_reset(void) {
+    memset(dogmEmu.ram, 0xA5, sizeof(dogmEmu.ram));
+    dogmEmu.page = 0;
+    dogmEmu.column = 0;
+    dogmEmu.startLine = 0;
+    dogmEmu.enabled = 0;
+    dogmEmu.inverted = 0;
+    dogmEmu.allPixelsOn = 0;
+    dogmEmu.adcReverse = 0;
+    dogmEmu.comReverse = 0;
+    dogmEmu.pending = 0;
+    dogmEmu_startFrame();
+}
+
+/*! @brief decode one command
+ *
+ * @param cmd   command byte
+ *
+ * This internal function changes the state like the ST7565 does. Unknown commands and commands without an effect on
+ * the panel content, like power control or bias, are ignored.
+ */
+static void dogmEmu_command(uint8_t cmd) {
+    if (dogmEmu.pending) {
+        // parameter of volume mode, indicator or booster
+        dogmEmu.pending = 0;
+        return;
+    }
+
+    if ((cmd & 0xF0) == DOGM_PAGE_ADDRESS) {
+        dogmEmu.page = (uint8_t) (cmd & 0x0F);
+        dogmEmu_counter.addressCommands++;
+    }
+    else if ((cmd & 0xF0) == DOGM_COL_ADDRESS) {
+        dogmEmu.column = (uint8_t) (((cmd & 0x0F) << 4) | (dogmEmu.column & 0x0F));
+        dogmEmu_counter.addressCommands++;
+    }
+    else if ((cmd & 0xF0) == 0x00) {
+        dogmEmu.column = (uint8_t) ((dogmEmu.column & 0xF0) | (cmd & 0x0F));
+        dogmEmu_counter.addressCommands++;
+    }
+    else if ((cmd & 0xC0) == DOGM_START_LINE) {
+        dogmEmu.startLine = (uint8_t) (cmd & 0x3F);
+    }
+    else if ((cmd & 0xFE) == DOGM_DISPLAY_ENABLE) {
+        dogmEmu.enabled = (uint8_t) (cmd & 0x01);
+    }
+    else if ((cmd & 0xFE) == DOGM_DISPLAY_INVERT) {
+        dogmEmu.inverted = (uint8_t) (cmd & 0x01);
+    }
+    else if ((cmd & 0xFE) == DOGM_ALL_PIXEL) {
+        dogmEmu.allPixelsOn = (uint8_t) (cmd & 0x01);
+    }
+    else if ((cmd & 0xFE) == DOGM_BOTTOMVIEW) {
+        dogmEmu.adcReverse = (uint8_t) (cmd & 0x01);
+    }
+    else if ((cmd & 0xF0) == DOGM_SCAN_DIR) {
+        dogmEmu.comReverse = (uint8_t) ((cmd & 0x08) ? 1 : 0);
+    }
+    else if (cmd == DOGM_VOLUME_MODE || (cmd & 0xFE) == DOGM_INDICATOR || cmd == DOGM_BOOSTER_SET) {
+        dogmEmu.pending = cmd;
+    }
+    else if (cmd == DOGM_RST_CMD) {
+        // software reset keeps the ram and the display settings
+        dogmEmu.page = 0;
+        dogmEmu.column = 0;
+        dogmEmu.startLine = 0;
+    }
+}
+
+void dogmEmu_receive(dogmHost_type_t type, uint8_t value) {
+    switch (type) {
+        case DOGM_HOST_RESET: {
+            dogmEmu_counter_t counter = dogmEmu_counter;
+            dogmEmu_reset();
+            dogmEmu_counter = counter;
+            break;
+        }
+        case DOGM_HOST_COMMAND:
+            dogmEmu_counter.bytes++;
+            dogmEmu_counter.commands++;
+            dogmEmu_command(value);
+            break;
+        case DOGM_HOST_DATA:
+            dogmEmu_counter.bytes++;
+            dogmEmu_counter.data++;
+            if ((dogmEmu.page < DOGM_EMU_PAGES) && (dogmEmu.column < DOGM_EMU_COLUMNS)) {
+                dogmEmu.ram[dogmEmu.page][dogmEmu.column] = value;
+            }
+            // the column address stops at the last column
+            if (dogmEmu.column < DOGM_EMU_COLUMNS - 1) {
+                dogmEmu.column++;
+            }
+            break;
+    }
+}
+
+const dogmEmu_state_t* dogmEmu_state(void) {
+    return &dogmEmu;
+}
+
+uint8_t dogmEmu_pixel(uint8_t x, uint8_t y) {
+    if ((x >= DOGM_DISPLAY_WIDTH) || (y >= DOGM_DISPLAY_HEIGHT) || !dogmEmu.enabled) {
+        return 0;
+    }
+    if (dogmEmu.allPixelsOn) {
+        return 1;
+    }
+
+    uint8_t line = (uint8_t) ((y + dogmEmu.startLine) & 0x3F);
+    uint8_t pixel = (uint8_t) ((dogmEmu.ram[line >> 3][x + DOGM_COLUMN_ADD] >> (line & 0x07)) & 0x01);
+    return (uint8_t) (pixel ^ dogmEmu.inverted);
+}
+
+void dogmEmu_panel(uint8_t panel[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH]) {
+    memset(panel, 0, DOGM_DISPLAY_PAGES * DOGM_DISPLAY_WIDTH);
+    for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+        for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+            panel[y >> 3][x] |= (uint8_t) (dogmEmu_pixel(x, y) << (y & 0x07));
+        }
+    }
+}
+
+uint16_t dogmEmu_diffRam(void) {
+    uint16_t count = 0;
+    for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+        // the logical row y is stored in the ram row behind the scroll offset
+        uint8_t row = (uint8_t) ((y + dogmGraphic_getScrollOffset()) & 0x3F);
+        for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+            uint8_t ram = (uint8_t) ((display_content[row >> 3][x] >> (row & 0x07)) & 0x01);
+            if (ram != dogmEmu_pixel(x, y)) {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+void dogmEmu_startFrame(void) {
+    memset(&dogmEmu_counter, 0, sizeof(dogmEmu_counter));
+}
+
+const dogmEmu_counter_t* dogmEmu_frame(void) {
+    return &dogmEmu_counter;
+}
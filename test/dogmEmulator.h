@@ -0,0 +1,149 @@
+/*! @file dogmEmulator.h
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+#ifndef MCU_DOGMEMULATOR_H
+#define MCU_DOGMEMULATOR_H
+
+#include <stdint.h>
+#include "../lcd_src/dogm128.h"
+
+/*! @brief size of the controller ram
+ *
+ * The ST7565 has 132 columns and 8 pages plus the icon page. The panel shows the columns from DOGM_COLUMN_ADD on.
+ */
+#define DOGM_EMU_PAGES          9
+#define DOGM_EMU_COLUMNS        132
+
+/*! @brief state of the emulated controller
+ *
+ * @param ram           display data ram
+ * @param page          actual page address
+ * @param column        actual column address, counted up by every data byte
+ * @param startLine     ram line shown in the first row of the panel
+ * @param enabled       display on
+ * @param inverted      display inverted
+ * @param allPixelsOn   all pixels on, independent of the ram
+ * @param adcReverse    segment driver direction reverse
+ * @param comReverse    common output direction reverse
+ * @param pending       first byte of a two byte command; 0 if none
+ */
+typedef struct {
+    uint8_t ram[DOGM_EMU_PAGES][DOGM_EMU_COLUMNS];
+    uint8_t page;
+    uint8_t column;
+    uint8_t startLine;
+    uint8_t enabled;
+    uint8_t inverted;
+    uint8_t allPixelsOn;
+    uint8_t adcReverse;
+    uint8_t comReverse;
+    uint8_t pending;
+} dogmEmu_state_t;
+
+/*! @brief counters of one frame
+ *
+ * @param bytes             all bytes received
+ * @param commands          command bytes, parameters of two byte commands included
+ * @param addressCommands   page and column address commands
+ * @param data              data bytes
+ */
+typedef struct {
+    uint32_t bytes;
+    uint32_t commands;
+    uint32_t addressCommands;
+    uint32_t data;
+} dogmEmu_counter_t;
+
+/*! @brief connect the emulator
+ *
+ * This function resets the emulator and sets it as listener of the host backend, so it receives every byte the display
+ * would receive.
+ */
+void dogmEmu_attach(void);
+
+/*! @brief power on state
+ *
+ * This function sets the controller to its state after a reset. The ram is filled with a pattern, because its content
+ * is undefined on the real controller. The frame counters are cleared.
+ */
+void dogmEmu_reset(void);
+
+/*! @brief receive one byte
+ *
+ * @param type      command, data or reset line
+ * @param value     byte on the wire
+ */
+void dogmEmu_receive(dogmHost_type_t type, uint8_t value);
+
+/*! @brief state of the controller
+ *
+ * @return  actual state, e.g. to check the start line
+ */
+const dogmEmu_state_t* dogmEmu_state(void);
+
+/*! @brief visible pixel
+ *
+ * @param x     horizontal position on the panel
+ * @param y     vertical position on the panel
+ *
+ * @return      1=pixel black; 0=pixel white
+ *
+ * This function returns the pixel as it is shown, including start line, inversion, all pixels on and display off. The
+ * coordinates are the ones of the library, with the orientation set up by dogm_init.
+ */
+uint8_t dogmEmu_pixel(uint8_t x, uint8_t y);
+
+/*! @brief visible panel in page format
+ *
+ * @param panel     destination with the same format as display_content
+ */
+void dogmEmu_panel(uint8_t panel[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH]);
+
+/*! @brief compare panel and ram copy
+ *
+ * @return  number of pixels, which differ between the visible panel and display_content
+ *
+ * The scroll offset of the ram copy is taken into account, so a correctly flushed display has no difference.
+ */
+uint16_t dogmEmu_diffRam(void);
+
+/*! @brief start a new frame
+ *
+ * This function clears the counters, so they only count the bytes of the next screen update.
+ */
+void dogmEmu_startFrame(void);
+
+/*! @brief counters of the actual frame
+ *
+ * @return  bytes and commands received since dogmEmu_startFrame
+ */
+const dogmEmu_counter_t* dogmEmu_frame(void);
+
+#endif //MCU_DOGMEMULATOR_H
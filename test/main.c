@@ -0,0 +1,106 @@
+/*! @file main.c
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+#include <stdio.h>
+#include "test.h"
+#include "../lcd_src/drawing/drawingInclude.h"
+
+static uint16_t test_checks;
+static uint16_t test_failures;
+
+void test_check(uint8_t ok, const char* expression, const char* file, int line) {
+    test_checks++;
+    if (!ok) {
+        test_failures++;
+        printf("FAILED: %s, %s, line: %d\n", expression, file, line);
+    }
+}
+
+void test_run(void (*function)(void), const char* name) {
+    uint16_t failures = test_failures;
+    function();
+    printf("%s %s\n", (failures == test_failures) ? "ok  " : "FAIL", name);
+}
+
+void test_resetDisplay(void) {
+    dogmGraphic_bind(&dogmGraphic_defaultDisplay);
+    dogm_init();
+    dogmGraphic_init();
+    dogmGraphic_flushRam(NULL);
+    dogmHost_clear();
+    dogmEmu_startFrame();
+}
+
+uint16_t test_dataBytes(void) {
+    const dogmHost_byte_t* record = dogmHost_record();
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < dogmHost_recordCount(); i++) {
+        if (record[i].type == DOGM_HOST_DATA) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void test_drawScene(void) {
+    coordinatePoint_t start = {5, 3};
+    coordinatePoint_t end = {60, 40};
+    coordinatePoint_t middle = {95, 30};
+
+    draw_figure_rectangleOutline(start, end);
+    draw_figure_circleFilled(middle, 12);
+    dogmGraphic_drawLineXY(0, 63, 120, 50, DRAW_LINE_DOTTED);
+}
+
+void test_drawSceneChange(void) {
+    coordinatePoint_t start = {30, 20};
+    coordinatePoint_t end = {110, 34};
+
+    dogmGraphic_drawArea(start.x, start.y, (uint8_t) (end.x - start.x + 1), (uint8_t) (end.y - start.y + 1), DOGM_CLEAR);
+    draw_font_setFont(FONT_PROP_8);
+    draw_font_setCursorLineEnd(DOGM_DISPLAY_WIDTH - 1);
+    draw_font_setCursorXY(start.x, (uint8_t) (start.y + 2));
+    draw_font_stringP(DOGM_SET, PSTR("alive."));
+}
+
+int main(void) {
+    dogmEmu_attach();
+
+    testFlush_run();
+    testEmulator_run();
+    testScroll_run();
+    testDisplays_run();
+    testDrawing_run();
+    testGray_run();
+    testAssets_run();
+
+    printf("%u checks, %u failed\n", test_checks, test_failures);
+    return test_failures ? 1 : 0;
+}
@@ -0,0 +1,92 @@
+/*! @file test.h
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+#ifndef MCU_TEST_H
+#define MCU_TEST_H
+
+#include <stdint.h>
+#include "../lcd_src/dogm128.h"
+#include "../lcd_src/dogm128-graphic.h"
+#include "dogmEmulator.h"
+
+/*! @brief check a condition
+ *
+ * A failed check is printed with file and line, the test goes on with the next check.
+ */
+#define TEST_CHECK(expression)  test_check((expression) ? 1 : 0, #expression, __FILE__, __LINE__)
+
+/*! @brief run one test function
+ */
+#define TEST_RUN(function)      test_run(function, #function)
+
+void test_check(uint8_t ok, const char* expression, const char* file, int line);
+
+void test_run(void (*function)(void), const char* name);
+
+/*! @brief start with a known display
+ *
+ * This function initializes the display and the ram copy, sends the empty ram copy once and clears the recording
+ * afterwards. So the display, the ram copy and a shadow copy are equal at the start of every test.
+ */
+void test_resetDisplay(void);
+
+/*! @brief count recorded data bytes
+ *
+ * @return  number of data bytes in the recording
+ */
+uint16_t test_dataBytes(void);
+
+/*! @brief draw some figures over several pages
+ */
+void test_drawScene(void);
+
+/*! @brief change a part of the scene
+ *
+ * This function clears a part of the scene and writes a text, so only some columns of some pages change.
+ */
+void test_drawSceneChange(void);
+
+// test suites
+
+void testFlush_run(void);
+
+void testEmulator_run(void);
+
+void testScroll_run(void);
+
+void testDisplays_run(void);
+
+void testDrawing_run(void);
+
+void testGray_run(void);
+
+void testAssets_run(void);
+
+#endif //MCU_TEST_H
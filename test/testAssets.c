@@ -0,0 +1,109 @@
+/*! @file testAssets.c
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+
+
+#include <string.h>
+#include "test.h"
+#include "../lcd_src/drawing/drawingInclude.h"
+#include "testAssetsRaw.h"
+#include "testAssetsRle.h"
+
+/*! @brief pixel of the display ram after a test_resetDisplay
+ */
+static uint8_t testAssets_pixel(uint8_t x, uint8_t y) {
+    return (uint8_t) ((display_content[y >> 3][x] >> (y & 0x07)) & 0x01);
+}
+
+static void testAssets_symbol(void) {
+    uint8_t expected[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+
+    // the plain and the binary copy of the hand-made symbol are the same array
+    TEST_CHECK(ok.width == symbol_ok.width);
+    TEST_CHECK(ok.height == symbol_ok.height);
+    TEST_CHECK(ok.format == DOGM_BITMAP_RAW);
+    TEST_CHECK(ok_copy.datapath == ok.datapath);
+
+    test_resetDisplay();
+    draw_figure_image((coordinatePoint_t) {10, 3}, symbol_ok, 0, DOGM_ADD);
+    memcpy(expected, display_content, sizeof(expected));
+    memset(display_content, 0, sizeof(display_content));
+    draw_figure_image((coordinatePoint_t) {10, 3}, ok, 0, DOGM_ADD);
+    TEST_CHECK(memcmp(expected, display_content, sizeof(expected)) == 0);
+}
+
+static void testAssets_gray(void) {
+    // gray values from 0 to 992 of 1023, the dark half is set
+    test_resetDisplay();
+    draw_figure_image((coordinatePoint_t) {0, 0}, gradient, 0, DOGM_ADD);
+    uint8_t wrong = 0;
+    for (uint8_t y = 0; y < gradient.height; y++) {
+        for (uint8_t x = 0; x < gradient.width; x++) {
+            wrong += (testAssets_pixel(x, y) != (x < 16));
+        }
+    }
+    TEST_CHECK(wrong == 0);
+
+    // a flat gray of 100 of 255 is dithered to about 61% set pixels, the noise is kept raw as it does not get smaller
+    TEST_CHECK(shade.format == DOGM_BITMAP_RAW);
+    test_resetDisplay();
+    draw_figure_image((coordinatePoint_t) {0, 0}, shade, 0, DOGM_ADD);
+    uint16_t count = 0;
+    for (uint8_t y = 0; y < shade.height; y++) {
+        for (uint8_t x = 0; x < shade.width; x++) {
+            count += testAssets_pixel(x, y);
+        }
+    }
+    TEST_CHECK((count > 280) && (count < 350));
+}
+
+static void testAssets_rle(void) {
+    // a frame of 61x20 with a steep line inside, encoded because it is smaller
+    TEST_CHECK(frame.format == DOGM_BITMAP_RLE);
+    test_resetDisplay();
+    draw_figure_image((coordinatePoint_t) {5, 7}, frame, 0, DOGM_SET);
+    uint8_t wrong = 0;
+    for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+        for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+            int16_t fx = (int16_t) x - 5;
+            int16_t fy = (int16_t) y - 7;
+            uint8_t inside = (fx >= 0) && (fx < 61) && (fy >= 0) && (fy < 20);
+            uint8_t set = inside && ((fx == 0) || (fx == 60) || (fy == 0) || (fy == 19) || (fx == fy * 3));
+            wrong += (testAssets_pixel(x, y) != set);
+        }
+    }
+    TEST_CHECK(wrong == 0);
+}
+
+void testAssets_run(void) {
+    TEST_RUN(testAssets_symbol);
+    TEST_RUN(testAssets_gray);
+    TEST_RUN(testAssets_rle);
+}
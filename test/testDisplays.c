@@ -0,0 +1,198 @@
+/*! @file testDisplays.c
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+
+
+#include <string.h>
+#include "test.h"
+#include "../lcd_src/drawing/drawingInclude.h"
+
+static dogmDisplay_t testDisplays_second;
+static const dogm_pins_t testDisplays_secondPins = {&dogmHost_port, 0x04, 0x08};
+
+/*! @brief start both displays with a reset
+ *
+ * The recording starts with the reset, so every display can be replayed completely afterwards.
+ */
+static void testDisplays_init(void) {
+    test_resetDisplay();
+    dogm_init();
+    dogmGraphic_init();
+
+    dogmGraphic_addDisplay(&testDisplays_second, &testDisplays_secondPins);
+    dogmGraphic_bind(&testDisplays_second);
+    dogm_initController();
+    dogmGraphic_init();
+    draw_font_setFont(FONT_PROP_8);
+    draw_font_setCursorLineEnd(DOGM_DISPLAY_WIDTH - 1);
+    dogmGraphic_bind(&dogmGraphic_defaultDisplay);
+}
+
+/*! @brief feed the emulator with the bytes of one display
+ *
+ * @param select    chip select of the display
+ *
+ * @return  number of bytes the display received
+ */
+static uint16_t testDisplays_replay(uint8_t select) {
+    const dogmHost_byte_t* record = dogmHost_record();
+    uint16_t count = 0;
+
+    dogmEmu_reset();
+    for (uint16_t i = 0; i < dogmHost_recordCount(); i++) {
+        if ((record[i].type == DOGM_HOST_RESET) || !(record[i].port & select)) {
+            dogmEmu_receive(record[i].type, record[i].value);
+            count++;
+        }
+    }
+    return count;
+}
+
+/*! @brief compare both displays with their emulated panels
+ */
+static void testDisplays_check(void) {
+    TEST_CHECK(dogmHost_lostBytes() == 0);
+
+    testDisplays_replay(testDisplays_secondPins.select);
+    dogmGraphic_bind(&testDisplays_second);
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+
+    testDisplays_replay(0x01);
+    dogmGraphic_bind(&dogmGraphic_defaultDisplay);
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+}
+
+static void testDisplays_async(void) {
+    testDisplays_init();
+
+    test_drawScene();
+    dogmGraphic_bind(&testDisplays_second);
+    test_drawSceneChange();
+    TEST_CHECK(draw_font_actualFont == FONT_PROP_8);
+    dogmGraphic_scroll(8);
+    dogmGraphic_bind(&dogmGraphic_defaultDisplay);
+
+    // one start sends both displays
+    uint16_t before = dogmHost_recordCount();
+    TEST_CHECK(dogmGraphic_flushRamAsyncStart());
+    dogmHost_runInterrupts();
+    TEST_CHECK(dogmGraphic_flushRamAsyncDone());
+    TEST_CHECK(dogmGraphic_defaultDisplay.newContent.value == 0);
+    TEST_CHECK(testDisplays_second.newContent.value == 0);
+    TEST_CHECK(dogmHost_recordCount() > before);
+    TEST_CHECK((dogmHost_port & 0x05) == 0x05);
+
+    testDisplays_check();
+    TEST_CHECK(dogmEmu_state()->startLine == 0);
+    testDisplays_replay(testDisplays_secondPins.select);
+    TEST_CHECK(dogmEmu_state()->startLine == 8);
+
+    dogmGraphic_removeDisplay(&testDisplays_second);
+}
+
+static void testDisplays_asyncScrollOnly(void) {
+    testDisplays_init();
+    dogmGraphic_bind(&testDisplays_second);
+    dogmGraphic_flushRam(NULL);
+    dogmGraphic_bind(&dogmGraphic_defaultDisplay);
+    dogmGraphic_flushRam(NULL);
+
+    // the start line follows the exposed rows out of the interrupt, the first display has nothing to send
+    dogmGraphic_bind(&testDisplays_second);
+    dogmGraphic_scroll(-5);
+    dogmGraphic_flushRam(NULL);
+    dogmGraphic_scroll(3);
+    dogmGraphic_bind(&dogmGraphic_defaultDisplay);
+    uint16_t before = dogmHost_recordCount();
+    TEST_CHECK(dogmGraphic_flushRamAsyncStart());
+    TEST_CHECK(!dogmGraphic_flushRamAsyncDone());
+    dogmHost_runInterrupts();
+    TEST_CHECK(dogmGraphic_flushRamAsyncDone());
+
+    uint16_t last = dogmHost_recordCount() - 1;
+    TEST_CHECK(last >= before);
+    TEST_CHECK(dogmHost_record()[last].type == DOGM_HOST_COMMAND);
+    TEST_CHECK(dogmHost_record()[last].value == (DOGM_START_LINE | 62));
+    for (uint16_t i = before; i <= last; i++) {
+        TEST_CHECK(!(dogmHost_record()[i].port & testDisplays_secondPins.select));
+    }
+    testDisplays_check();
+    testDisplays_replay(testDisplays_secondPins.select);
+    TEST_CHECK(dogmEmu_state()->startLine == 62);
+    TEST_CHECK((dogmHost_port & 0x05) == 0x05);
+
+    dogmGraphic_removeDisplay(&testDisplays_second);
+}
+
+static void testDisplays_stepAndBind(void) {
+    testDisplays_init();
+
+    dogmGraphic_bind(&testDisplays_second);
+    test_drawScene();
+    dogmGraphic_bind(&dogmGraphic_defaultDisplay);
+    test_drawScene();
+    test_drawSceneChange();
+
+    // the second display is taken after the first one, so drawing on it between the steps is still sent
+    TEST_CHECK(!dogmGraphic_flushStep(40));
+    dogmGraphic_bind(&testDisplays_second);
+    test_drawSceneChange();
+    while (!dogmGraphic_flushStep(40));
+    TEST_CHECK(testDisplays_second.newContent.value == 0);
+    dogmGraphic_bind(&dogmGraphic_defaultDisplay);
+
+    testDisplays_check();
+    dogmGraphic_removeDisplay(&testDisplays_second);
+}
+
+static void testDisplays_remove(void) {
+    testDisplays_init();
+
+    dogmGraphic_bind(&testDisplays_second);
+    dogmGraphic_drawDot(1, 1);
+    dogmGraphic_removeDisplay(&testDisplays_second);
+    TEST_CHECK(dogmGraphic_display == &dogmGraphic_defaultDisplay);
+
+    // a removed display is not part of the flush anymore
+    dogmGraphic_flushRam(NULL);
+    dogmHost_clear();
+    dogmGraphic_drawDot(2, 2);
+    dogmGraphic_flushRamAsyncStart();
+    dogmHost_runInterrupts();
+    TEST_CHECK(test_dataBytes() == 1);
+    TEST_CHECK(testDisplays_second.newContent.value != 0);
+}
+
+void testDisplays_run(void) {
+    TEST_RUN(testDisplays_async);
+    TEST_RUN(testDisplays_asyncScrollOnly);
+    TEST_RUN(testDisplays_stepAndBind);
+    TEST_RUN(testDisplays_remove);
+}
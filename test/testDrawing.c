@@ -0,0 +1,1333 @@
+/*! @file testDrawing.c
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+
+
+#include <string.h>
+#include "test.h"
+#include "../lcd_src/drawing/drawingInclude.h"
+
+/*! @brief pixel model of the display, one byte per pixel
+ */
+static uint8_t testDrawing_model[DOGM_DISPLAY_HEIGHT][DOGM_DISPLAY_WIDTH];
+
+/*! @brief logical pixel of the ram copy
+ */
+static uint8_t testDrawing_pixel(uint8_t x, uint8_t y) {
+    uint8_t row = (uint8_t) ((y + dogmGraphic_getScrollOffset()) & 0x3F);
+    return (uint8_t) ((display_content[row >> 3][x] >> (row & 0x07)) & 0x01);
+}
+
+/*! @brief fill the model and the ram copy with the same noise
+ */
+static void testDrawing_noise(uint8_t seed) {
+    uint16_t value = (uint16_t) (seed * 97 + 13);
+    for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+        for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+            value = (uint16_t) (value * 75 + 74);
+            testDrawing_model[y][x] = (uint8_t) ((value >> 7) & 0x01);
+        }
+    }
+    for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+        uint8_t row = (uint8_t) ((y + dogmGraphic_getScrollOffset()) & 0x3F);
+        for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+            uint8_t mask = (uint8_t) (1 << (row & 0x07));
+            if (testDrawing_model[y][x]) {
+                display_content[row >> 3][x] |= mask;
+            }
+            else {
+                display_content[row >> 3][x] &= (uint8_t) ~mask;
+            }
+        }
+    }
+}
+
+/*! @brief number of pixels, which differ between the model and the ram copy
+ */
+static uint16_t testDrawing_diffModel(void) {
+    uint16_t count = 0;
+    for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+        for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+            if (testDrawing_pixel(x, y) != testDrawing_model[y][x]) {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+/*! @brief draw an area into the model
+ */
+static void testDrawing_modelArea(uint8_t start_x, uint8_t start_y, uint8_t width, uint8_t height,
+                                  dogmGraphic_drawType_t type) {
+    for (uint16_t y = start_y; (y < (uint16_t) (start_y + height)) && (y < DOGM_DISPLAY_HEIGHT); y++) {
+        for (uint16_t x = start_x; (x < (uint16_t) (start_x + width)) && (x < DOGM_DISPLAY_WIDTH); x++) {
+            switch (type) {
+                case DOGM_CLEAR:
+                    testDrawing_model[y][x] = 0;
+                    break;
+                case DOGM_INVERT:
+                    testDrawing_model[y][x] ^= 1;
+                    break;
+                default:
+                    testDrawing_model[y][x] = 1;
+            }
+        }
+    }
+}
+
+static void testDrawing_area(void) {
+    static const uint8_t areas[][4] = {
+            {0,   0,  128, 64},
+            {5,   3,  1,   1},
+            {10,  8,  20,  8},
+            {10,  7,  20,  10},
+            {1,   1,  126, 62},
+            {100, 60, 40,  10},
+            {64,  0,  1,   64},
+            {0,   31, 128, 2},
+            {7,   9,  3,   5},
+            {127, 63, 5,   5}
+    };
+
+    test_resetDisplay();
+    for (uint8_t scroll = 0; scroll < 2; scroll++) {
+        for (uint8_t type = DOGM_ADD; type <= DOGM_SET; type++) {
+            for (uint8_t i = 0; i < sizeof(areas) / sizeof(areas[0]); i++) {
+                testDrawing_noise((uint8_t) (i + type * 16));
+                dogmGraphic_drawArea(areas[i][0], areas[i][1], areas[i][2], areas[i][3],
+                                     (dogmGraphic_drawType_t) type);
+                testDrawing_modelArea(areas[i][0], areas[i][1], areas[i][2], areas[i][3],
+                                      (dogmGraphic_drawType_t) type);
+                TEST_CHECK(testDrawing_diffModel() == 0);
+            }
+        }
+        // the same areas again, wrapped around the end of the ram
+        dogmGraphic_scroll(-21);
+    }
+}
+
+/*! @brief clip rectangle used by the model
+ */
+static clipRect_t testDrawing_clip;
+
+/*! @brief set the clip rectangle of the display and the model
+ */
+static void testDrawing_setClip(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+    dogmGraphic_setClip(x0, y0, x1, y1);
+    testDrawing_clip = dogmGraphic_getClip();
+}
+
+/*! @brief set a pixel of the model, if it is visible
+ */
+static void testDrawing_modelSet(int16_t x, int16_t y, uint8_t value) {
+    if ((x >= testDrawing_clip.x0) && (x <= testDrawing_clip.x1) &&
+        (y >= testDrawing_clip.y0) && (y <= testDrawing_clip.y1)) {
+        testDrawing_model[y][x] = value;
+    }
+}
+
+/*! @brief draw a line into the model with the plain Bresenham loop and a check of every pixel
+ */
+/*! @brief set a visible pixel of the model
+ */
+static void testDrawing_modelDot(int16_t x, int16_t y) {
+    testDrawing_modelSet(x, y, 1);
+}
+
+/*! @brief walk a line with the plain Bresenham loop and pass every pixel
+ */
+static void testDrawing_walkLine(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint8_t lineType,
+                                 void (*plot)(int16_t x, int16_t y)) {
+    int16_t dx = (int16_t) end_x - start_x;
+    int16_t dy = (int16_t) end_y - start_y;
+    int16_t incx = (dx > 0) ? 1 : (dx < 0) ? -1 : 0;
+    int16_t incy = (dy > 0) ? 1 : (dy < 0) ? -1 : 0;
+    int16_t el, es, pdx, pdy;
+    if (dx < 0) { dx = -dx; }
+    if (dy < 0) { dy = -dy; }
+    if (dx > dy) {
+        pdx = incx;
+        pdy = 0;
+        es = dy;
+        el = dx;
+    }
+    else {
+        pdx = 0;
+        pdy = incy;
+        es = dx;
+        el = dy;
+    }
+
+    int16_t x = start_x;
+    int16_t y = start_y;
+    int16_t err = el >> 1;
+    plot(x, y);
+    for (int16_t t = 0; t < el; t++) {
+        err -= es;
+        if (err < 0) {
+            err += el;
+            x += incx;
+            y += incy;
+        }
+        else {
+            x += pdx;
+            y += pdy;
+        }
+        if ((lineType == 0) || ((lineType == 1) && (t & 0x01)) || ((lineType == 2) && (t & 0x02))) {
+            plot(x, y);
+        }
+    }
+}
+
+/*! @brief draw a line into the model with a check of every pixel
+ */
+static void testDrawing_modelLine(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint8_t lineType) {
+    testDrawing_walkLine(start_x, start_y, end_x, end_y, lineType, testDrawing_modelDot);
+}
+
+static void testDrawing_line(void) {
+    static const uint8_t clips[][4] = {
+            {0,  0,  127, 63},
+            {10, 5,  100, 50},
+            {40, 20, 41,  60},
+            {0,  30, 127, 30},
+            {90, 0,  255, 255}
+    };
+    static const uint8_t lines[][4] = {
+            {0,   0,   127, 63},
+            {127, 0,   0,   63},
+            {5,   40,  120, 2},
+            {64,  0,   64,  63},
+            {0,   30,  127, 30},
+            {3,   3,   3,   3},
+            {200, 10,  10,  250},
+            {255, 255, 0,   0},
+            {140, 0,   200, 63},
+            {0,   70,  127, 90},
+            {41,  100, 41,  0}
+    };
+
+    test_resetDisplay();
+    for (uint8_t scroll = 0; scroll < 2; scroll++) {
+        for (uint8_t c = 0; c < sizeof(clips) / sizeof(clips[0]); c++) {
+            testDrawing_setClip(clips[c][0], clips[c][1], clips[c][2], clips[c][3]);
+            for (uint8_t lineType = 0; lineType < 3; lineType++) {
+                for (uint8_t i = 0; i < sizeof(lines) / sizeof(lines[0]); i++) {
+                    testDrawing_noise((uint8_t) (i + lineType * 16 + c));
+                    dogmGraphic_drawLineXY(lines[i][0], lines[i][1], lines[i][2], lines[i][3], lineType);
+                    testDrawing_modelLine(lines[i][0], lines[i][1], lines[i][2], lines[i][3], lineType);
+                    TEST_CHECK(testDrawing_diffModel() == 0);
+                }
+            }
+        }
+
+        // pseudo random lines
+        uint16_t value = 7;
+        for (uint16_t i = 0; i < 400; i++) {
+            uint8_t p[8];
+            for (uint8_t k = 0; k < 8; k++) {
+                value = (uint16_t) (value * 75 + 74);
+                p[k] = (uint8_t) (value >> 8);
+            }
+            testDrawing_setClip(p[4] & 0x7F, p[5] & 0x3F, p[6], (p[7] & 0x3F) | 0x20);
+            testDrawing_noise((uint8_t) i);
+            dogmGraphic_drawLineXY(p[0], p[1] & 0x7F, p[2], p[3] & 0x7F, (uint8_t) (i % 3));
+            testDrawing_modelLine(p[0], p[1] & 0x7F, p[2], p[3] & 0x7F, (uint8_t) (i % 3));
+            TEST_CHECK(testDrawing_diffModel() == 0);
+        }
+        dogmGraphic_resetClip();
+        dogmGraphic_scroll(-21);
+    }
+}
+
+static void testDrawing_clipArea(void) {
+    test_resetDisplay();
+    testDrawing_setClip(20, 10, 90, 40);
+    for (uint8_t type = DOGM_ADD; type <= DOGM_SET; type++) {
+        testDrawing_noise(type);
+        dogmGraphic_drawArea(0, 0, 128, 64, (dogmGraphic_drawType_t) type);
+        dogmGraphic_drawArea(80, 35, 40, 20, (dogmGraphic_drawType_t) type);
+        testDrawing_modelArea(20, 10, 71, 31, (dogmGraphic_drawType_t) type);
+        testDrawing_modelArea(80, 35, 11, 6, (dogmGraphic_drawType_t) type);
+        TEST_CHECK(testDrawing_diffModel() == 0);
+    }
+
+    // an empty clip rectangle hides everything
+    testDrawing_setClip(50, 0, 49, 63);
+    testDrawing_noise(9);
+    dogmGraphic_drawArea(0, 0, 128, 64, DOGM_INVERT);
+    dogmGraphic_drawCircleOutline(64, 32, 20, 1);
+    TEST_CHECK(testDrawing_diffModel() == 0);
+
+    dogmGraphic_resetClip();
+    clipRect_t clip = dogmGraphic_getClip();
+    TEST_CHECK((clip.x0 == 0) && (clip.y0 == 0) && (clip.x1 == 127) && (clip.y1 == 63));
+}
+
+static void testDrawing_circle(void) {
+    static const uint8_t circles[][3] = {
+            {64, 32, 20},
+            {10, 10, 25},
+            {120, 60, 30},
+            {64, 32, 100}
+    };
+
+    test_resetDisplay();
+    for (uint8_t i = 0; i < sizeof(circles) / sizeof(circles[0]); i++) {
+        for (uint8_t filled = 0; filled < 2; filled++) {
+            // the circle clipped by the display only gives the reference pixels
+            testDrawing_setClip(0, 0, 127, 63);
+            memset(display_content, 0, sizeof(display_content));
+            dogmGraphic_drawCircleOutline(circles[i][0], circles[i][1], circles[i][2], filled);
+            for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+                for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+                    uint8_t inside = (x >= 30) && (x <= 100) && (y >= 5) && (y <= 45);
+                    testDrawing_model[y][x] = inside ? testDrawing_pixel(x, y) : 0;
+                }
+            }
+
+            testDrawing_setClip(30, 5, 100, 45);
+            memset(display_content, 0, sizeof(display_content));
+            dogmGraphic_drawCircleOutline(circles[i][0], circles[i][1], circles[i][2], filled);
+            TEST_CHECK(testDrawing_diffModel() == 0);
+        }
+    }
+    dogmGraphic_resetClip();
+}
+
+/*! @brief pixel of the ellipse model
+ */
+static uint8_t testDrawing_inEllipse(int16_t dx, int16_t dy, uint8_t a, uint8_t b) {
+    if ((dx > a) || (dx < -a) || (dy > b) || (dy < -b)) {
+        return 0;
+    }
+    uint64_t a2 = (uint64_t) a * a;
+    uint64_t b2 = (uint64_t) b * b;
+    uint64_t limit = a2 * b2 + (((uint64_t) a * b * (a + b)) >> 1);
+    return (b2 * (uint64_t) (dx * dx) + a2 * (uint64_t) (dy * dy)) <= limit;
+}
+
+static void testDrawing_ellipse(void) {
+    static const uint8_t ellipses[][4] = {
+            {64, 32, 0,  0},
+            {64, 32, 5,  0},
+            {64, 32, 0,  7},
+            {64, 32, 30, 12},
+            {64, 32, 9,  25},
+            {64, 32, 31, 31},
+            {5,  60, 40, 20},
+            {100, 3, 80, 90}
+    };
+
+    test_resetDisplay();
+    for (uint8_t i = 0; i < sizeof(ellipses) / sizeof(ellipses[0]); i++) {
+        uint8_t cx = ellipses[i][0];
+        uint8_t cy = ellipses[i][1];
+        uint8_t a = ellipses[i][2];
+        uint8_t b = ellipses[i][3];
+
+        // filled, every pixel of the model
+        for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+            for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+                testDrawing_model[y][x] = testDrawing_inEllipse((int16_t) x - cx, (int16_t) y - cy, a, b);
+            }
+        }
+        memset(display_content, 0, sizeof(display_content));
+        dogmGraphic_drawEllipse(cx, cy, a, b, 1);
+        TEST_CHECK(testDrawing_diffModel() == 0);
+
+        // outline, inside of the filled ellipse and on every pixel at its border
+        memset(display_content, 0, sizeof(display_content));
+        dogmGraphic_drawEllipse(cx, cy, a, b, 0);
+        uint16_t wrong = 0;
+        for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+            for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+                int16_t dx = (int16_t) x - cx;
+                int16_t dy = (int16_t) y - cy;
+                uint8_t inside = testDrawing_inEllipse(dx, dy, a, b);
+                uint8_t border = inside && (!testDrawing_inEllipse(dx + 1, dy, a, b) ||
+                                            !testDrawing_inEllipse(dx - 1, dy, a, b) ||
+                                            !testDrawing_inEllipse(dx, dy + 1, a, b) ||
+                                            !testDrawing_inEllipse(dx, dy - 1, a, b));
+                uint8_t pixel = testDrawing_pixel(x, y);
+                if ((pixel && !inside) || (border && !pixel)) {
+                    wrong++;
+                }
+            }
+        }
+        TEST_CHECK(wrong == 0);
+    }
+}
+
+/*! @brief top and bottom outline row of every column of the polygon model
+ */
+static int16_t testDrawing_spans[DOGM_DISPLAY_WIDTH][2];
+
+/*! @brief extend the span of a column by an outline pixel
+ */
+static void testDrawing_spanDot(int16_t x, int16_t y) {
+    if ((x < 0) || (x >= DOGM_DISPLAY_WIDTH)) {
+        return;
+    }
+    if (y < testDrawing_spans[x][0]) {
+        testDrawing_spans[x][0] = y;
+    }
+    if (y > testDrawing_spans[x][1]) {
+        testDrawing_spans[x][1] = y;
+    }
+}
+
+/*! @brief fill a polygon into the model, every column between its top and bottom outline pixel
+ */
+static void testDrawing_modelPolygon(const coordinatePoint_t *points, uint8_t count, dogmGraphic_drawType_t type) {
+    for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+        testDrawing_spans[x][0] = INT16_MAX;
+        testDrawing_spans[x][1] = INT16_MIN;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        const coordinatePoint_t *next = &points[(i + 1) % count];
+        testDrawing_walkLine(points[i].x, points[i].y, next->x, next->y, 0, testDrawing_spanDot);
+    }
+
+    for (int16_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+        for (int16_t y = testDrawing_spans[x][0]; y <= testDrawing_spans[x][1]; y++) {
+            if ((y >= 0) && (y < DOGM_DISPLAY_HEIGHT)) {
+                uint8_t value = (type == DOGM_CLEAR) ? 0 : (type == DOGM_INVERT) ? !testDrawing_model[y][x] : 1;
+                testDrawing_modelSet(x, y, value);
+            }
+        }
+    }
+}
+
+static void testDrawing_polygon(void) {
+    static const coordinatePoint_t triangles[][3] = {
+            {{10, 10}, {40, 20}, {5, 50}},
+            {{64, 0},  {127, 63}, {0, 63}},
+            {{3, 3},   {3, 3},   {3, 3}},
+            {{20, 30}, {100, 31}, {60, 32}},
+            {{50, 10}, {52, 60}, {51, 35}},
+            {{120, 5}, {200, 40}, {90, 100}}
+    };
+    static const coordinatePoint_t needle[] = {{64, 60}, {60, 56}, {20, 8}, {68, 56}};
+
+    test_resetDisplay();
+    for (uint8_t c = 0; c < 2; c++) {
+        if (c) {
+            testDrawing_setClip(15, 12, 90, 45);
+        }
+        else {
+            testDrawing_setClip(0, 0, 127, 63);
+        }
+        for (uint8_t type = DOGM_ADD; type <= DOGM_SET; type++) {
+            for (uint8_t i = 0; i < sizeof(triangles) / sizeof(triangles[0]); i++) {
+                testDrawing_noise((uint8_t) (i + type * 16 + c));
+                dogmGraphic_drawTriangle(triangles[i][0].x, triangles[i][0].y, triangles[i][1].x, triangles[i][1].y,
+                                         triangles[i][2].x, triangles[i][2].y, (dogmGraphic_drawType_t) type);
+                testDrawing_modelPolygon(triangles[i], 3, (dogmGraphic_drawType_t) type);
+                TEST_CHECK(testDrawing_diffModel() == 0);
+            }
+            testDrawing_noise((uint8_t) (type + c));
+            dogmGraphic_drawPolygon(needle, 4, (dogmGraphic_drawType_t) type);
+            testDrawing_modelPolygon(needle, 4, (dogmGraphic_drawType_t) type);
+            TEST_CHECK(testDrawing_diffModel() == 0);
+        }
+    }
+    dogmGraphic_resetClip();
+
+    // a filled arrow has the pixels of the outline and the dot in the middle
+    memset(display_content, 0, sizeof(display_content));
+    draw_figure_triangleOutline((coordinatePoint_t) {30, 20}, (coordinatePoint_t) {32, 22},
+                                (coordinatePoint_t) {32, 18});
+    draw_figure_dotSmall((coordinatePoint_t) {31, 20});
+    uint8_t expected[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+    memcpy(expected, display_content, sizeof(expected));
+    memset(display_content, 0, sizeof(display_content));
+    draw_figure_triangleFilled((coordinatePoint_t) {30, 20}, (coordinatePoint_t) {32, 22},
+                               (coordinatePoint_t) {32, 18});
+    TEST_CHECK(memcmp(expected, display_content, sizeof(expected)) == 0);
+}
+
+/*! @brief image of 20x13 pixels in the page format of drawP
+ */
+static uint8_t testDrawing_image[2][20];
+
+/*! @brief draw an image into the model
+ */
+static void testDrawing_modelImage(uint8_t start_x, uint8_t start_y, dogmGraphic_drawType_t type) {
+    for (uint8_t y = 0; y < 13; y++) {
+        for (uint8_t x = 0; x < 20; x++) {
+            uint8_t set = (uint8_t) ((testDrawing_image[y >> 3][x] >> (y & 0x07)) & 0x01);
+            int16_t px = (int16_t) start_x + x;
+            int16_t py = (int16_t) start_y + y;
+            if ((px > 127) || (py > 63)) {
+                continue;
+            }
+            switch (type) {
+                case DOGM_ADD:
+                    if (set) {
+                        testDrawing_modelSet(px, py, 1);
+                    }
+                    break;
+                case DOGM_CLEAR:
+                    if (set) {
+                        testDrawing_modelSet(px, py, 0);
+                    }
+                    break;
+                case DOGM_INVERT:
+                    testDrawing_modelSet(px, py, !set);
+                    break;
+                default:
+                    testDrawing_modelSet(px, py, set);
+            }
+        }
+    }
+}
+
+static void testDrawing_imageClip(void) {
+    static const uint8_t positions[][2] = {
+            {0,   0},
+            {3,   5},
+            {50,  8},
+            {117, 27},
+            {110, 55},
+            {60,  60}
+    };
+    static const uint8_t clips[][4] = {
+            {0,  0,  127, 63},
+            {5,  9,  60,  30},
+            {55, 3,  115, 58}
+    };
+
+    uint16_t value = 3;
+    for (uint8_t i = 0; i < sizeof(testDrawing_image); i++) {
+        value = (uint16_t) (value * 75 + 74);
+        ((uint8_t *) testDrawing_image)[i] = (uint8_t) (value >> 5);
+    }
+    // the padding bits of the last page are not part of the image
+    for (uint8_t x = 0; x < 20; x++) {
+        testDrawing_image[1][x] &= 0x1F;
+    }
+
+    test_resetDisplay();
+    for (uint8_t scroll = 0; scroll < 2; scroll++) {
+        for (uint8_t c = 0; c < sizeof(clips) / sizeof(clips[0]); c++) {
+            testDrawing_setClip(clips[c][0], clips[c][1], clips[c][2], clips[c][3]);
+            for (uint8_t type = DOGM_ADD; type <= DOGM_SET; type++) {
+                for (uint8_t i = 0; i < sizeof(positions) / sizeof(positions[0]); i++) {
+                    testDrawing_noise((uint8_t) (i + type * 16 + c));
+                    dogmGraphic_drawP(positions[i][0], positions[i][1], 20, 13, (dogmGraphic_drawType_t) type,
+                                      testDrawing_image);
+                    testDrawing_modelImage(positions[i][0], positions[i][1], (dogmGraphic_drawType_t) type);
+                    TEST_CHECK(testDrawing_diffModel() == 0);
+                }
+            }
+        }
+        dogmGraphic_resetClip();
+        dogmGraphic_scroll(-27);
+    }
+}
+
+/*! @brief sprite sheet of 30x21 pixels in ram
+ */
+static uint8_t testDrawing_sheet[3][30];
+
+static void testDrawing_blit(void) {
+    const dogmGraphic_bitmap_t sheet = {testDrawing_sheet, 30, 21, DOGM_MEMORY_RAM};
+    uint16_t value = 11;
+    for (uint8_t i = 0; i < sizeof(testDrawing_sheet); i++) {
+        value = (uint16_t) (value * 75 + 74);
+        ((uint8_t *) testDrawing_sheet)[i] = (uint8_t) (value >> 4);
+    }
+
+    test_resetDisplay();
+    for (uint8_t scroll = 0; scroll < 2; scroll++) {
+        for (uint16_t i = 0; i < 200; i++) {
+            uint8_t p[8];
+            for (uint8_t k = 0; k < 8; k++) {
+                value = (uint16_t) (value * 75 + 74);
+                p[k] = (uint8_t) (value >> 8);
+            }
+            uint8_t start_x = p[0] & 0x7F;
+            uint8_t start_y = p[1] & 0x3F;
+            uint8_t source_x = p[2] % 32;
+            uint8_t source_y = p[3] % 24;
+            uint8_t width = p[4] % 34;
+            uint8_t height = p[5] % 26;
+            dogmGraphic_drawType_t type = (dogmGraphic_drawType_t) (i & 0x03);
+            if (p[6] & 0x01) {
+                testDrawing_setClip(p[6] & 0x3F, p[7] & 0x1F, (p[6] & 0x3F) + 60, (p[7] & 0x1F) + 30);
+            }
+            else {
+                testDrawing_setClip(0, 0, 127, 63);
+            }
+
+            testDrawing_noise((uint8_t) i);
+            dogmGraphic_blit(start_x, start_y, &sheet, source_x, source_y, width, height, type);
+            for (uint8_t y = 0; y < height; y++) {
+                for (uint8_t x = 0; x < width; x++) {
+                    uint8_t sx = (uint8_t) (source_x + x);
+                    uint8_t sy = (uint8_t) (source_y + y);
+                    if ((sx >= 30) || (sy >= 21) || ((start_x + x) > 127) || ((start_y + y) > 63)) {
+                        continue;
+                    }
+                    uint8_t set = (uint8_t) ((testDrawing_sheet[sy >> 3][sx] >> (sy & 0x07)) & 0x01);
+                    int16_t px = (int16_t) (start_x + x);
+                    int16_t py = (int16_t) (start_y + y);
+                    if ((type == DOGM_SET) || ((type == DOGM_ADD) && set)) {
+                        testDrawing_modelSet(px, py, set);
+                    }
+                    else if ((type == DOGM_CLEAR) && set) {
+                        testDrawing_modelSet(px, py, 0);
+                    }
+                    else if (type == DOGM_INVERT) {
+                        testDrawing_modelSet(px, py, !set);
+                    }
+                }
+            }
+            TEST_CHECK(testDrawing_diffModel() == 0);
+        }
+        dogmGraphic_resetClip();
+        dogmGraphic_scroll(19);
+    }
+}
+
+/*! @brief run length encode page data with runs of 0x00 and 0xFF, repeats of three and more bytes and literals
+ */
+static uint16_t testDrawing_encodeRle(const uint8_t *data, uint16_t size, uint8_t *encoded) {
+    uint16_t length = 0;
+    uint16_t i = 0;
+    while (i < size) {
+        uint8_t run = 1;
+        while ((i + run < size) && (run <= DOGM_RLE_COUNT) && (data[i + run] == data[i])) {
+            run++;
+        }
+        if ((data[i] == 0x00) || (data[i] == 0xFF)) {
+            encoded[length++] = (uint8_t) ((data[i] ? DOGM_RLE_ONES : DOGM_RLE_ZEROS) | (run - 1));
+        }
+        else if (run >= 3) {
+            encoded[length++] = (uint8_t) (DOGM_RLE_REPEAT | (run - 1));
+            encoded[length++] = data[i];
+        }
+        else {
+            uint16_t code = length++;
+            run = 0;
+            while ((i + run < size) && (run <= DOGM_RLE_COUNT) && (data[i + run] != 0x00) &&
+                   (data[i + run] != 0xFF) &&
+                   !((i + run + 2 < size) && (data[i + run + 1] == data[i + run]) &&
+                     (data[i + run + 2] == data[i + run]))) {
+                encoded[length++] = data[i + run];
+                run++;
+            }
+            encoded[code] = (uint8_t) (DOGM_RLE_LITERAL | (run - 1));
+        }
+        i += run;
+    }
+    return length;
+}
+
+static void testDrawing_rle(void) {
+    static uint8_t sheet[4][70];
+    static uint8_t encoded[4 * 70 * 2];
+    uint8_t expected[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+    uint16_t value = 7;
+
+    // long runs of zeros, ones and repeats, a repeat into the next page and literals between them
+    memset(sheet, 0, sizeof(sheet));
+    for (uint8_t x = 0; x < 70; x++) {
+        value = (uint16_t) (value * 75 + 74);
+        sheet[1][x] = (x < 20) ? (uint8_t) (value >> 4) : (x <= 50) ? 0xFF : 0xA5;
+        sheet[2][x] = (x < 10) ? 0xA5 : (x & 0x04) ? (uint8_t) (value >> 8) : 0x3C;
+        sheet[3][x] = (x % 9) ? 0x00 : (uint8_t) (x | 0x01);
+    }
+    uint16_t length = testDrawing_encodeRle((const uint8_t *) sheet, sizeof(sheet), encoded);
+    TEST_CHECK(length < sizeof(sheet));
+    const dogmGraphic_bitmap_t raw = {sheet, 70, 29, DOGM_MEMORY_RAM, DOGM_BITMAP_RAW};
+    const dogmGraphic_bitmap_t rle = {encoded, 70, 29, DOGM_MEMORY_RAM, DOGM_BITMAP_RLE};
+
+    // every part, position, clip and draw type is the same as the raw bitmap
+    test_resetDisplay();
+    for (uint8_t scroll = 0; scroll < 2; scroll++) {
+        for (uint16_t i = 0; i < 200; i++) {
+            uint8_t p[8];
+            for (uint8_t k = 0; k < 8; k++) {
+                value = (uint16_t) (value * 75 + 74);
+                p[k] = (uint8_t) (value >> 8);
+            }
+            uint8_t source_x = p[2] % 72;
+            uint8_t source_y = p[3] % 31;
+            uint8_t width = p[4] % 74;
+            uint8_t height = p[5] % 33;
+            dogmGraphic_drawType_t type = (dogmGraphic_drawType_t) (i & 0x03);
+            if (p[6] & 0x01) {
+                testDrawing_setClip(p[6] & 0x3F, p[7] & 0x1F, (p[6] & 0x3F) + 60, (p[7] & 0x1F) + 30);
+            }
+            else {
+                testDrawing_setClip(0, 0, 127, 63);
+            }
+
+            testDrawing_noise((uint8_t) i);
+            dogmGraphic_blit(p[0] & 0x7F, p[1] & 0x3F, &raw, source_x, source_y, width, height, type);
+            memcpy(expected, display_content, sizeof(expected));
+            testDrawing_noise((uint8_t) i);
+            dogmGraphic_blit(p[0] & 0x7F, p[1] & 0x3F, &rle, source_x, source_y, width, height, type);
+            TEST_CHECK(memcmp(expected, display_content, sizeof(expected)) == 0);
+        }
+        dogmGraphic_resetClip();
+        dogmGraphic_scroll(21);
+    }
+
+    // images from the drawing layer
+    test_resetDisplay();
+    draw_figure_image((coordinatePoint_t) {3, 5}, (imageData_t) {sheet, 70, 29}, 1, DOGM_SET);
+    memcpy(expected, display_content, sizeof(expected));
+    memset(display_content, 0, sizeof(display_content));
+    draw_figure_image((coordinatePoint_t) {3, 5}, (imageData_t) {encoded, 70, 29, DOGM_BITMAP_RLE}, 1, DOGM_SET);
+    TEST_CHECK(memcmp(expected, display_content, sizeof(expected)) == 0);
+}
+
+static void testDrawing_cache(void) {
+    static const uint8_t icon[2][8] = {
+            {0x18, 0x3C, 0x7E, 0xFF, 0xFF, 0x7E, 0x3C, 0x18},
+            {0x01, 0x02, 0x03, 0x00, 0x00, 0x03, 0x02, 0x01}
+    };
+
+    test_resetDisplay();
+    dogmGraphic_clearCache();
+    uint8_t expected[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+    for (uint8_t round = 0; round < 3; round++) {
+        memset(display_content, 0, sizeof(display_content));
+        dogmGraphic_drawP(10, 5, 8, 10, DOGM_SET, icon);
+        dogmGraphic_drawP(30, 13, 8, 10, DOGM_INVERT, icon);
+        dogmGraphic_drawP(50, 8, 8, 10, DOGM_ADD, icon);
+        if (!round) {
+            memcpy(expected, display_content, sizeof(expected));
+        }
+        TEST_CHECK(memcmp(expected, display_content, sizeof(expected)) == 0);
+    }
+
+#if DOGM_SPRITE_CACHE_ENTRIES
+    // y 5 and 13 have the same bit offset, y 8 another one
+    TEST_CHECK(dogmGraphic_getCacheMisses() == 2);
+    TEST_CHECK(dogmGraphic_getCacheHits() == 7);
+#else
+    TEST_CHECK(dogmGraphic_getCacheMisses() == 0);
+    TEST_CHECK(dogmGraphic_getCacheHits() == 0);
+#endif
+    dogmGraphic_clearCache();
+    TEST_CHECK(dogmGraphic_getCacheHits() == 0);
+}
+
+/*! @brief draw a small widget with its top left corner at x/y
+ */
+static void testDrawing_widget(uint8_t x, uint8_t y) {
+    dogmGraphic_drawArea(x, y, 40, 3, DOGM_SET);
+    dogmGraphic_drawLineXY(x, y + 3, x + 39, y + 19, 0);
+    dogmGraphic_drawCircleOutline(x + 30, y + 10, 12, 0);
+    dogmGraphic_drawTriangle(x + 2, y + 18, x + 10, y + 6, x + 14, y + 17, DOGM_INVERT);
+    dogmGraphic_drawP(x + 20, y + 5, 20, 13, DOGM_ADD, testDrawing_image);
+}
+
+static void testDrawing_canvas(void) {
+    dogmCanvas_t widget;
+    dogmCanvas_t frame;
+    test_resetDisplay();
+    dogmGraphic_releaseCanvases();
+    TEST_CHECK(dogmGraphic_createCanvas(&widget, 40, 20));
+    TEST_CHECK(dogmGraphic_createCanvas(&frame, 64, 30));
+    TEST_CHECK(!dogmGraphic_createCanvas(&frame, 129, 8));
+
+    // render the widget once
+    dogmGraphic_drawToCanvas(&widget);
+    testDrawing_widget(0, 0);
+    dogmGraphic_drawToCanvas(NULL);
+    TEST_CHECK(dogmGraphic_newContent.value == 0);
+
+    for (uint8_t scroll = 0; scroll < 2; scroll++) {
+        // the same widget drawn directly, clipped to its size
+        memset(display_content, 0, sizeof(display_content));
+        dogmGraphic_setClip(13, 27, 13 + 39, 27 + 19);
+        testDrawing_widget(13, 27);
+        dogmGraphic_resetClip();
+        uint8_t expected[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+        memcpy(expected, display_content, sizeof(expected));
+
+        memset(display_content, 0, sizeof(display_content));
+        dogmGraphic_blitCanvas(13, 27, &widget, DOGM_ADD);
+        TEST_CHECK(memcmp(expected, display_content, sizeof(expected)) == 0);
+
+        // composed into another canvas first, the display scrolls while the canvas is drawn
+        dogmGraphic_drawToCanvas(&frame);
+        dogmGraphic_clearCanvas(&frame);
+        dogmGraphic_blitCanvas(10, 7, &widget, DOGM_SET);
+        dogmGraphic_drawToCanvas(NULL);
+        memset(display_content, 0, sizeof(display_content));
+        dogmGraphic_blitCanvas(3, 20, &frame, DOGM_SET);
+        TEST_CHECK(memcmp(expected, display_content, sizeof(expected)) == 0);
+
+        dogmGraphic_scroll(-37);
+    }
+    dogmGraphic_releaseCanvases();
+}
+
+static void testDrawing_saveUnder(void) {
+    dogmSaveUnder_t outer;
+    dogmSaveUnder_t inner;
+    uint8_t buffer[DOGM_SAVE_UNDER_BYTES(88, 20)];
+    test_resetDisplay();
+    dogmGraphic_releaseCanvases();
+    TEST_CHECK(!dogmGraphic_saveUnder(&outer, NULL, 128, 0, 8, 8));
+
+    for (uint8_t scroll = 0; scroll < 2; scroll++) {
+        testDrawing_noise(scroll + 11);
+
+        // nested popups, the outer one in the arena
+        TEST_CHECK(dogmGraphic_saveUnder(&outer, NULL, 20, 13, 30, 22));
+        uint8_t *arena = outer.buffer;
+        dogmGraphic_drawArea(20, 13, 30, 22, DOGM_SET);
+        TEST_CHECK(dogmGraphic_saveUnder(&inner, buffer, 40, 5, 100, 20));
+        TEST_CHECK(inner.width == 88);
+        dogmGraphic_drawArea(40, 5, 88, 20, DOGM_INVERT);
+
+        // drawn beside the popups on their edge pages, kept by the restore
+        dogmGraphic_drawDot(25, 12);
+        testDrawing_model[12][25] = 1;
+        dogmGraphic_drawDot(30, 35);
+        testDrawing_model[35][30] = 1;
+
+        dogmGraphic_restoreUnder(&inner);
+        TEST_CHECK(inner.buffer == NULL);
+        dogmGraphic_newContent.value = 0;
+        dogmGraphic_restoreUnder(&outer);
+        TEST_CHECK(testDrawing_diffModel() == 0);
+
+        // only the pages and columns of the outer popup changed
+        uint8_t row = (uint8_t) ((13 + dogmGraphic_getScrollOffset()) & 0x3F);
+        uint8_t expected = 0;
+        for (uint8_t k = 0; k < 22; k++) {
+            expected |= (uint8_t) (1 << (((row + k) & 0x3F) >> 3));
+        }
+        TEST_CHECK(dogmGraphic_newContent.value == expected);
+        for (uint8_t page = 0; page < DOGM_DISPLAY_PAGES; page++) {
+            if (expected & (1 << page)) {
+                TEST_CHECK(dogmGraphic_newColumns[page].start == 20);
+                TEST_CHECK(dogmGraphic_newColumns[page].end == 49);
+            }
+        }
+
+        // the arena memory was given back
+        TEST_CHECK(dogmGraphic_saveUnder(&outer, NULL, 0, 0, 8, 8));
+        TEST_CHECK(outer.buffer == arena);
+        dogmGraphic_restoreUnder(&outer);
+
+        dogmGraphic_scroll(-29);
+    }
+}
+
+/*! @brief draw a pattern area into the model
+ */
+static void testDrawing_modelPattern(uint8_t start_x, uint8_t start_y, uint8_t width, uint8_t height,
+                                     const uint8_t *pattern, dogmGraphic_drawType_t type) {
+    for (int16_t y = start_y; y < start_y + height; y++) {
+        for (int16_t x = start_x; x < start_x + width; x++) {
+            if ((x >= DOGM_DISPLAY_WIDTH) || (y >= DOGM_DISPLAY_HEIGHT)) {
+                continue;
+            }
+            uint8_t bit = (uint8_t) ((pattern[x & 0x07] >> (y & 0x07)) & 0x01);
+            switch (type) {
+                case DOGM_ADD:
+                    testDrawing_modelSet(x, y, testDrawing_model[y][x] | bit);
+                    break;
+                case DOGM_CLEAR:
+                    testDrawing_modelSet(x, y, testDrawing_model[y][x] & (uint8_t) !bit);
+                    break;
+                case DOGM_INVERT:
+                    testDrawing_modelSet(x, y, testDrawing_model[y][x] ^ bit);
+                    break;
+                default:
+                    testDrawing_modelSet(x, y, bit);
+            }
+        }
+    }
+}
+
+static void testDrawing_pattern(void) {
+    static const uint8_t areas[][4] = {
+            {0,  0,  128, 64},
+            {5,  3,  1,   1},
+            {10, 7,  20,  10},
+            {37, 13, 61,  41},
+            {100, 60, 40, 10}
+    };
+    uint8_t pattern[8];
+    uint8_t previous[8] = {0};
+
+    // every dither level adds one pixel to the level below
+    for (uint8_t level = 0; level <= 64; level++) {
+        dogmGraphic_setDitherPattern(pattern, level);
+        uint8_t count = 0;
+        for (uint8_t i = 0; i < 8; i++) {
+            TEST_CHECK((previous[i] & (uint8_t) ~pattern[i]) == 0);
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                count += (pattern[i] >> bit) & 0x01;
+            }
+            previous[i] = pattern[i];
+        }
+        TEST_CHECK(count == level);
+    }
+    dogmGraphic_setHatchPattern(pattern, DOGM_HATCH_CHECKER);
+    dogmGraphic_setDitherPattern(previous, 32);
+    TEST_CHECK(memcmp(pattern, previous, sizeof(pattern)) == 0);
+
+    test_resetDisplay();
+    for (uint8_t scroll = 0; scroll < 2; scroll++) {
+        for (uint8_t type = DOGM_ADD; type <= DOGM_SET; type++) {
+            for (uint8_t i = 0; i < sizeof(areas) / sizeof(areas[0]); i++) {
+                if (i & 0x01) {
+                    dogmGraphic_setHatchPattern(pattern, (dogmGraphic_hatch_t) ((type + i) % 6));
+                }
+                else {
+                    dogmGraphic_setDitherPattern(pattern, (uint8_t) (7 + type * 13 + i));
+                }
+                testDrawing_setClip(0, 0, 127, (i == 3) ? 40 : 63);
+                testDrawing_noise((uint8_t) (i + type * 16));
+                dogmGraphic_drawPatternArea(areas[i][0], areas[i][1], areas[i][2], areas[i][3], pattern,
+                                            (dogmGraphic_drawType_t) type);
+                testDrawing_modelPattern(areas[i][0], areas[i][1], areas[i][2], areas[i][3], pattern,
+                                         (dogmGraphic_drawType_t) type);
+                TEST_CHECK(testDrawing_diffModel() == 0);
+            }
+        }
+        // the pattern stays fixed to the coordinates, when the ram rows are scrolled
+        dogmGraphic_scroll(-21);
+    }
+    dogmGraphic_resetClip();
+}
+
+/*! @brief square of the distance of a pixel to a line segment, in 1/256 pixel²
+ */
+static int32_t testDrawing_distance(int16_t x, int16_t y, int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    int32_t dx = x1 - x0;
+    int32_t dy = y1 - y0;
+    int32_t length2 = dx * dx + dy * dy;
+    int32_t t = ((x - x0) * dx + (y - y0) * dy) * 256;
+    t = (t < 0) ? 0 : (t > length2 * 256) ? 256 : t / length2;
+    int32_t px = (x - x0) * 256 - t * dx;
+    int32_t py = (y - y0) * 256 - t * dy;
+    return (px * px + py * py) >> 8;
+}
+
+static void testDrawing_stroke(void) {
+    static const uint8_t lines[][5] = {
+            {10, 10, 100, 40, 3},
+            {20, 60, 30,  2,  4},
+            {2,  2,  125, 61, 7},
+            {120, 5, 5,   50, 2}
+    };
+    uint8_t reference[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+    test_resetDisplay();
+
+    // a width of 1 is the plain line, straight lines are areas
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawLineXY(3, 7, 90, 50, DRAW_LINE_FILLED);
+    memcpy(reference, display_content, sizeof(reference));
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawLineStroke(3, 7, 90, 50, 1);
+    TEST_CHECK(memcmp(reference, display_content, sizeof(reference)) == 0);
+
+    memset(testDrawing_model, 0, sizeof(testDrawing_model));
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawLineStroke(100, 20, 10, 20, 4);
+    dogmGraphic_drawLineStroke(60, 0, 60, 30, 3);
+    testDrawing_modelArea(10, 18, 91, 4, DOGM_ADD);
+    testDrawing_modelArea(59, 0, 3, 31, DOGM_ADD);
+    TEST_CHECK(testDrawing_diffModel() == 0);
+
+    // sloped lines cover the plain line and stay inside of their width
+    for (uint8_t i = 0; i < sizeof(lines) / sizeof(lines[0]); i++) {
+        const uint8_t *line = lines[i];
+        memset(display_content, 0, sizeof(display_content));
+        dogmGraphic_drawLineXY(line[0], line[1], line[2], line[3], DRAW_LINE_FILLED);
+        memcpy(reference, display_content, sizeof(reference));
+        memset(display_content, 0, sizeof(display_content));
+        dogmGraphic_drawLineStroke(line[0], line[1], line[2], line[3], line[4]);
+
+        int32_t limit = ((line[4] + 1) * (line[4] + 1) * 256) >> 2;
+        uint16_t wrong = 0;
+        uint16_t count = 0;
+        for (uint8_t page = 0; page < DOGM_DISPLAY_PAGES; page++) {
+            for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+                if (reference[page][x] & ~display_content[page][x]) {
+                    wrong++;
+                }
+            }
+        }
+        for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+            for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+                if (testDrawing_pixel(x, y)) {
+                    count++;
+                    if (testDrawing_distance(x, y, line[0], line[1], line[2], line[3]) > limit) {
+                        wrong++;
+                    }
+                }
+            }
+        }
+        TEST_CHECK(wrong == 0);
+        TEST_CHECK(count >= (line[4] - 1) * (uint16_t) ((line[0] > line[2]) ? line[0] - line[2] : line[2] - line[0]));
+
+        // clipped, the same pixels as the line clipped by the display only
+        for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+            for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+                uint8_t inside = (x >= 30) && (x <= 100) && (y >= 5) && (y <= 45);
+                testDrawing_model[y][x] = inside ? testDrawing_pixel(x, y) : 0;
+            }
+        }
+        testDrawing_setClip(30, 5, 100, 45);
+        memset(display_content, 0, sizeof(display_content));
+        dogmGraphic_drawLineStroke(line[0], line[1], line[2], line[3], line[4]);
+        TEST_CHECK(testDrawing_diffModel() == 0);
+        dogmGraphic_resetClip();
+    }
+
+    // ends far outside of the display, the length of the normal needs more than 16 bits for its square
+    static const uint8_t longLines[][5] = {
+            {0,   0,  255, 160, 6},
+            {250, 0,  0,   150, 4}
+    };
+    for (uint8_t i = 0; i < sizeof(longLines) / sizeof(longLines[0]); i++) {
+        const uint8_t *line = longLines[i];
+        memset(display_content, 0, sizeof(display_content));
+        dogmGraphic_drawLineStroke(line[0], line[1], line[2], line[3], line[4]);
+
+        // the corners are rounded to whole pixels, the distance is exact, because the lines are long
+        int32_t dx = line[2] - line[0];
+        int32_t dy = line[3] - line[1];
+        int64_t limit = (int64_t) (line[4] + 3) * (line[4] + 3) * (dx * dx + dy * dy);
+        uint16_t wrong = 0;
+        for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+            uint8_t column = 0;
+            for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+                if (testDrawing_pixel(x, y)) {
+                    int64_t cross = (int64_t) (x - line[0]) * dy - (int64_t) (y - line[1]) * dx;
+                    column++;
+                    if (4 * cross * cross > limit) {
+                        wrong++;
+                    }
+                }
+            }
+            // a column crossing the stroke inside of the display has at least its width
+            int32_t middle = line[1] + (x - line[0]) * dy / dx;
+            if ((middle >= line[4]) && (middle < DOGM_DISPLAY_HEIGHT - line[4]) && (column < line[4] - 1)) {
+                wrong++;
+            }
+        }
+        TEST_CHECK(wrong == 0);
+    }
+
+    // rectangles keep their outer size
+    for (uint8_t width = 1; width < 8; width += 3) {
+        memset(testDrawing_model, 0, sizeof(testDrawing_model));
+        testDrawing_modelArea(20, 10, 50, 30, DOGM_ADD);
+        testDrawing_modelArea((uint8_t) (20 + width), (uint8_t) (10 + width), (uint8_t) (50 - 2 * width),
+                              (uint8_t) (30 - 2 * width), DOGM_CLEAR);
+        memset(display_content, 0, sizeof(display_content));
+        dogmGraphic_drawRectangleStroke(20, 10, 50, 30, width);
+        TEST_CHECK(testDrawing_diffModel() == 0);
+    }
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawRectangleStroke(20, 10, 50, 30, 15);
+    testDrawing_modelArea(20, 10, 50, 30, DOGM_ADD);
+    TEST_CHECK(testDrawing_diffModel() == 0);
+
+    // rings between two ellipses of the model, a width of 1 is the outline
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawEllipse(64, 32, 40, 20, 0);
+    memcpy(reference, display_content, sizeof(reference));
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawEllipseStroke(64, 32, 40, 20, 1);
+    TEST_CHECK(memcmp(reference, display_content, sizeof(reference)) == 0);
+
+    static const uint8_t rings[][5] = {
+            {64, 32, 40, 20, 3},
+            {64, 32, 25, 25, 6},
+            {10, 60, 30, 12, 2},
+            {64, 32, 10, 10, 10}
+    };
+    for (uint8_t i = 0; i < sizeof(rings) / sizeof(rings[0]); i++) {
+        const uint8_t *ring = rings[i];
+        for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+            for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+                int16_t dx = (int16_t) x - ring[0];
+                int16_t dy = (int16_t) y - ring[1];
+                testDrawing_model[y][x] = testDrawing_inEllipse(dx, dy, ring[2], ring[3]) &&
+                                          !testDrawing_inEllipse(dx, dy, (uint8_t) (ring[2] - ring[4]),
+                                                                 (uint8_t) (ring[3] - ring[4]));
+            }
+        }
+        memset(display_content, 0, sizeof(display_content));
+        if (ring[2] == ring[3]) {
+            dogmGraphic_drawCircleStroke(ring[0], ring[1], ring[2], ring[4]);
+        }
+        else {
+            dogmGraphic_drawEllipseStroke(ring[0], ring[1], ring[2], ring[3], ring[4]);
+        }
+        TEST_CHECK(testDrawing_diffModel() == 0);
+    }
+}
+
+/*! @brief take the drawn pixels as the model
+ */
+static void testDrawing_modelCopy(void) {
+    for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+        for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+            testDrawing_model[y][x] = testDrawing_pixel(x, y);
+        }
+    }
+}
+
+/*! @brief model of the wedge of an arc from start to end, counterclockwise
+ */
+static uint8_t testDrawing_inWedge(int16_t dx, int16_t dy, int16_t start, int16_t end) {
+    if (end - start >= 360) {
+        return 1;
+    }
+    int16_t sweep = (int16_t) (((end - start) % 360 + 360) % 360);
+    int32_t start_x = dogmGraphic_cos(start);
+    int32_t start_y = dogmGraphic_sin(start);
+    int32_t end_x = dogmGraphic_cos(end);
+    int32_t end_y = dogmGraphic_sin(end);
+    int32_t py = -dy;
+    int32_t fromStart = start_x * py - start_y * dx;
+    int32_t toEnd = end_y * dx - end_x * py;
+    if (!sweep) {
+        return 0;
+    }
+    if (sweep <= 180) {
+        return (fromStart >= 0) && (toEnd >= 0);
+    }
+    return !((fromStart < 0) && (toEnd < 0));
+}
+
+/*! @brief model of a rectangle with rounded corners
+ */
+static uint8_t testDrawing_inRounded(int16_t x, int16_t y, int16_t x0, int16_t y0, int16_t width, int16_t height,
+                                     uint8_t radius) {
+    int16_t x1 = x0 + width - 1;
+    int16_t y1 = y0 + height - 1;
+    if ((x < x0) || (x > x1) || (y < y0) || (y > y1)) {
+        return 0;
+    }
+    int16_t dx = (x < x0 + radius) ? x0 + radius - x : (x > x1 - radius) ? x - (x1 - radius) : 0;
+    int16_t dy = (y < y0 + radius) ? y0 + radius - y : (y > y1 - radius) ? y - (y1 - radius) : 0;
+    return testDrawing_inEllipse(dx, dy, radius, radius);
+}
+
+static void testDrawing_arc(void) {
+    test_resetDisplay();
+
+    TEST_CHECK(dogmGraphic_sin(0) == 0);
+    TEST_CHECK(dogmGraphic_sin(30) == DOGM_TRIG_ONE / 2);
+    TEST_CHECK(dogmGraphic_sin(90) == DOGM_TRIG_ONE);
+    TEST_CHECK(dogmGraphic_sin(210) == -DOGM_TRIG_ONE / 2);
+    TEST_CHECK(dogmGraphic_sin(-90) == -DOGM_TRIG_ONE);
+    TEST_CHECK(dogmGraphic_sin(450) == DOGM_TRIG_ONE);
+    TEST_CHECK(dogmGraphic_cos(0) == DOGM_TRIG_ONE);
+    TEST_CHECK(dogmGraphic_cos(180) == -DOGM_TRIG_ONE);
+    TEST_CHECK(dogmGraphic_cos(-60) == DOGM_TRIG_ONE / 2);
+    TEST_CHECK(dogmGraphic_cos(32767) == dogmGraphic_cos(32767 % 360));
+
+    // arcs and pies against the ring and the wedge of the model
+    static const int16_t arcs[][6] = {
+            {64, 32, 30, 0,   90,  4},
+            {64, 32, 30, 45,  315, 6},
+            {64, 32, 25, -45, 225, 1},
+            {20, 50, 28, 200, 380, 5},
+            {64, 32, 20, 10,  11,  21},
+            {64, 32, 20, 0,   180, 21},
+            {64, 32, 20, 300, 60,  3},
+            {64, 32, 20, 90,  450, 3},
+            {64, 32, 20, 90,  90,  3}
+    };
+    for (uint8_t i = 0; i < sizeof(arcs) / sizeof(arcs[0]); i++) {
+        const int16_t *arc = arcs[i];
+        uint8_t radius = (uint8_t) arc[2];
+        uint8_t width = (uint8_t) arc[5];
+        for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+            for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+                int16_t dx = (int16_t) x - arc[0];
+                int16_t dy = (int16_t) y - arc[1];
+                uint8_t ring = testDrawing_inEllipse(dx, dy, radius, radius) &&
+                               ((width > radius) || !testDrawing_inEllipse(dx, dy, (uint8_t) (radius - width),
+                                                                         (uint8_t) (radius - width)));
+                testDrawing_model[y][x] = ring && testDrawing_inWedge(dx, dy, arc[3], arc[4]);
+            }
+        }
+        memset(display_content, 0, sizeof(display_content));
+        if (width > radius) {
+            dogmGraphic_drawPie((uint8_t) arc[0], (uint8_t) arc[1], radius, arc[3], arc[4]);
+        }
+        else {
+            dogmGraphic_drawArc((uint8_t) arc[0], (uint8_t) arc[1], radius, arc[3], arc[4], width);
+        }
+        TEST_CHECK(testDrawing_diffModel() == 0);
+    }
+
+    // two pies meeting at a ray are the whole circle
+    memset(testDrawing_model, 0, sizeof(testDrawing_model));
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawCircleOutline(64, 32, 28, 1);
+    testDrawing_modelCopy();
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawPie(64, 32, 28, 0, 120);
+    dogmGraphic_drawPie(64, 32, 28, 120, 360);
+    TEST_CHECK(testDrawing_diffModel() == 0);
+
+    // a full arc is the ring of a circle stroke
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawCircleStroke(64, 32, 30, 4);
+    testDrawing_modelCopy();
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawArc(64, 32, 30, 17, 377, 4);
+    TEST_CHECK(testDrawing_diffModel() == 0);
+
+    // clipped, the same pixels as the arc clipped by the display only
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawArc(64, 32, 30, -45, 225, 5);
+    for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+        for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+            uint8_t inside = (x >= 40) && (x <= 80) && (y >= 10) && (y <= 40);
+            testDrawing_model[y][x] = inside ? testDrawing_pixel(x, y) : 0;
+        }
+    }
+    testDrawing_setClip(40, 10, 80, 40);
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawArc(64, 32, 30, -45, 225, 5);
+    TEST_CHECK(testDrawing_diffModel() == 0);
+    dogmGraphic_resetClip();
+
+    // a needle is a line from the inner to the outer radius
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawLineXY(74, 32, 94, 32, DRAW_LINE_FILLED);
+    dogmGraphic_drawLineXY(64, 27, 64, 2, DRAW_LINE_FILLED);
+    dogmGraphic_drawArea(63, 0, 3, 33, DOGM_ADD);
+    testDrawing_modelCopy();
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawNeedle(64, 32, 10, 30, 0, 1);
+    dogmGraphic_drawNeedle(64, 32, 5, 30, 90, 1);
+    dogmGraphic_drawNeedle(64, 32, 0, 40, 90, 3);
+    TEST_CHECK(testDrawing_diffModel() == 0);
+
+    // a needle crossing the border of the display is clipped like any stroke
+    memset(testDrawing_model, 0, sizeof(testDrawing_model));
+    testDrawing_modelArea(125, 32, 3, 1, DOGM_ADD);
+    testDrawing_modelArea(0, 59, 6, 3, DOGM_ADD);
+    testDrawing_modelArea(64, 0, 1, 6, DOGM_ADD);
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawNeedle(120, 32, 5, 30, 0, 1);
+    dogmGraphic_drawNeedle(5, 60, 0, 20, 180, 3);
+    dogmGraphic_drawNeedle(64, 5, 0, 20, 90, 1);
+    TEST_CHECK(testDrawing_diffModel() == 0);
+
+    // inside of a viewport, the needle keeps its pixels
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawNeedle(100, 40, 0, 50, 150, 3);
+    for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+        for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+            uint8_t inside = (x >= 60) && (y >= 20);
+            testDrawing_model[y][x] = inside ? testDrawing_pixel(x, y) : 0;
+        }
+    }
+    testDrawing_setClip(60, 20, 127, 63);
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawNeedle(100, 40, 0, 50, 150, 3);
+    TEST_CHECK(testDrawing_diffModel() == 0);
+    dogmGraphic_resetClip();
+
+    // rounded rectangles, the inner corners of a stroke have the radius reduced by the width
+    static const uint8_t rectangles[][6] = {
+            {10,  5,  60, 40, 8,  0},
+            {10,  5,  60, 40, 8,  1},
+            {10,  5,  60, 40, 8,  3},
+            {10,  5,  60, 40, 3,  5},
+            {0,   0,  128, 64, 10, 2},
+            {100, 40, 50, 40, 12, 3},
+            {20,  20, 30, 10, 20, 0},
+            {20,  20, 30, 10, 20, 5}
+    };
+    for (uint8_t i = 0; i < sizeof(rectangles) / sizeof(rectangles[0]); i++) {
+        const uint8_t *rectangle = rectangles[i];
+        uint8_t shorter = (rectangle[2] < rectangle[3]) ? rectangle[2] : rectangle[3];
+        uint8_t radius = (rectangle[4] > (shorter - 1) / 2) ? (uint8_t) ((shorter - 1) / 2) : rectangle[4];
+        uint8_t width = rectangle[5];
+        uint8_t filled = !width || (2 * width >= shorter);
+        uint8_t inner = (radius > width) ? (uint8_t) (radius - width) : 0;
+        for (uint8_t y = 0; y < DOGM_DISPLAY_HEIGHT; y++) {
+            for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+                testDrawing_model[y][x] =
+                        testDrawing_inRounded(x, y, rectangle[0], rectangle[1], rectangle[2], rectangle[3], radius) &&
+                        (filled || !testDrawing_inRounded(x, y, rectangle[0] + width, rectangle[1] + width,
+                                                          rectangle[2] - 2 * width, rectangle[3] - 2 * width, inner));
+            }
+        }
+        memset(display_content, 0, sizeof(display_content));
+        if (width) {
+            dogmGraphic_drawRoundedRectangleStroke(rectangle[0], rectangle[1], rectangle[2], rectangle[3],
+                                                   rectangle[4], width);
+        }
+        else {
+            dogmGraphic_drawRoundedRectangle(rectangle[0], rectangle[1], rectangle[2], rectangle[3], rectangle[4], 1);
+        }
+        TEST_CHECK(testDrawing_diffModel() == 0);
+    }
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawRoundedRectangleStroke(10, 5, 60, 40, 8, 1);
+    testDrawing_modelCopy();
+    memset(display_content, 0, sizeof(display_content));
+    dogmGraphic_drawRoundedRectangle(10, 5, 60, 40, 8, 0);
+    TEST_CHECK(testDrawing_diffModel() == 0);
+}
+
+void testDrawing_run(void) {
+    TEST_RUN(testDrawing_area);
+    TEST_RUN(testDrawing_line);
+    TEST_RUN(testDrawing_clipArea);
+    TEST_RUN(testDrawing_circle);
+    TEST_RUN(testDrawing_ellipse);
+    TEST_RUN(testDrawing_polygon);
+    TEST_RUN(testDrawing_imageClip);
+    TEST_RUN(testDrawing_blit);
+    TEST_RUN(testDrawing_cache);
+    TEST_RUN(testDrawing_canvas);
+    TEST_RUN(testDrawing_saveUnder);
+    TEST_RUN(testDrawing_pattern);
+    TEST_RUN(testDrawing_stroke);
+    TEST_RUN(testDrawing_arc);
+    TEST_RUN(testDrawing_rle);
+}
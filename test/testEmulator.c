@@ -0,0 +1,176 @@
+/*! @file testEmulator.c
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "../lcd_src/drawing/drawingInclude.h"
+
+/*! @brief ways to flush the ram copy
+ */
+typedef enum {
+    TEST_FLUSH_BLOCKING = 0,
+    TEST_FLUSH_ASYNC,
+    TEST_FLUSH_STEP_SMALL,
+    TEST_FLUSH_STEP_LARGE,
+    TEST_FLUSH_METHODS
+} testEmulator_method_t;
+
+static uint8_t testEmulator_expected[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+static uint8_t testEmulator_panel[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+
+static void testEmulator_flush(testEmulator_method_t method) {
+    switch (method) {
+        default:
+        case TEST_FLUSH_BLOCKING:
+            dogmGraphic_flushRam(NULL);
+            break;
+        case TEST_FLUSH_ASYNC:
+            dogmGraphic_flushRamAsyncStart();
+            dogmHost_runInterrupts();
+            break;
+        case TEST_FLUSH_STEP_SMALL:
+            while (!dogmGraphic_flushStep(1));
+            break;
+        case TEST_FLUSH_STEP_LARGE:
+            while (!dogmGraphic_flushStep(50));
+            break;
+    }
+}
+
+static void testEmulator_init(void) {
+    test_resetDisplay();
+
+    const dogmEmu_state_t* state = dogmEmu_state();
+    TEST_CHECK(state->enabled);
+    TEST_CHECK(!state->inverted);
+    TEST_CHECK(!state->allPixelsOn);
+    TEST_CHECK(state->startLine == 0);
+    TEST_CHECK(state->comReverse);
+    TEST_CHECK(!state->pending);
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+}
+
+static void testEmulator_commands(void) {
+    test_resetDisplay();
+    dogmGraphic_drawDot(0, 8);
+    dogmGraphic_flushRam(NULL);
+    TEST_CHECK(dogmEmu_pixel(0, 8));
+
+    DOGM_USE_FIRST_LINE(8);
+    TEST_CHECK(dogmEmu_state()->startLine == 8);
+    TEST_CHECK(dogmEmu_pixel(0, 0));
+    TEST_CHECK(!dogmEmu_pixel(0, 8));
+    DOGM_USE_FIRST_LINE(0);
+
+    DOGM_USE_MODE_INVERTED();
+    TEST_CHECK(dogmEmu_pixel(5, 5));
+    TEST_CHECK(!dogmEmu_pixel(0, 8));
+    DOGM_USE_MODE_POSITIVE();
+
+    DOGM_ALL_PIXELS_ON();
+    TEST_CHECK(dogmEmu_pixel(5, 5));
+    DOGM_ALL_PIXELS_OFF();
+
+    DOGM_OFF();
+    TEST_CHECK(!dogmEmu_pixel(0, 8));
+    DOGM_ON();
+    TEST_CHECK(dogmEmu_pixel(0, 8));
+
+    // two byte commands must not be decoded as address
+    DOGM_USE_VOLUME_MODE(0x12);
+    TEST_CHECK(!dogmEmu_state()->pending);
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+}
+
+static void testEmulator_flushPathsIdentical(void) {
+    for (uint8_t method = 0; method < TEST_FLUSH_METHODS; method++) {
+        test_resetDisplay();
+        test_drawScene();
+        testEmulator_flush((testEmulator_method_t) method);
+        test_drawSceneChange();
+        testEmulator_flush((testEmulator_method_t) method);
+
+        TEST_CHECK(dogmEmu_diffRam() == 0);
+        dogmEmu_panel(testEmulator_panel);
+        if (method == TEST_FLUSH_BLOCKING) {
+            memcpy(testEmulator_expected, testEmulator_panel, sizeof(testEmulator_expected));
+        }
+        TEST_CHECK(memcmp(testEmulator_expected, testEmulator_panel, sizeof(testEmulator_expected)) == 0);
+    }
+}
+
+/*! @brief print the cost of one update
+ */
+static void testEmulator_printFrame(const char* name) {
+    const dogmEmu_counter_t* frame = dogmEmu_frame();
+    printf("    %-20s %5lu bytes %5lu commands %5lu data\n", name, (unsigned long) frame->bytes,
+           (unsigned long) frame->commands, (unsigned long) frame->data);
+    dogmEmu_startFrame();
+}
+
+static void testEmulator_updateCost(void) {
+    test_resetDisplay();
+
+    dogmGraphic_clearWholeDisplay();
+    dogmGraphic_flushRam(NULL);
+#if DOGM_USE_SHADOW_RAM
+    TEST_CHECK(dogmEmu_frame()->bytes == 0);
+#else
+    TEST_CHECK(dogmEmu_frame()->bytes == DOGM_DISPLAY_PAGES * (3 + DOGM_DISPLAY_WIDTH));
+#endif
+    testEmulator_printFrame("clear display");
+
+    dogmGraphic_drawDot(64, 32);
+    dogmGraphic_flushRam(NULL);
+    TEST_CHECK(dogmEmu_frame()->bytes == 4);
+    testEmulator_printFrame("single dot");
+
+    test_drawScene();
+    dogmGraphic_flushRam(NULL);
+    testEmulator_printFrame("scene");
+
+    test_drawSceneChange();
+    dogmGraphic_flushRam(NULL);
+    testEmulator_printFrame("text in scene");
+
+    test_drawSceneChange();
+    dogmGraphic_flushRam(NULL);
+    testEmulator_printFrame("same text again");
+
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+}
+
+void testEmulator_run(void) {
+    TEST_RUN(testEmulator_init);
+    TEST_RUN(testEmulator_commands);
+    TEST_RUN(testEmulator_flushPathsIdentical);
+    TEST_RUN(testEmulator_updateCost);
+}
@@ -0,0 +1,166 @@
+/*! @file testFlush.c
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+#include <string.h>
+#include "test.h"
+
+static dogmHost_byte_t testFlush_expected[DOGM_HOST_RECORD_SIZE];
+static uint16_t testFlush_expectedCount;
+
+/*! @brief keep the recording to compare it later
+ */
+static void testFlush_keepRecord(void) {
+    testFlush_expectedCount = dogmHost_recordCount();
+    memcpy(testFlush_expected, dogmHost_record(), testFlush_expectedCount * sizeof(dogmHost_byte_t));
+}
+
+static uint8_t testFlush_equalsKeptRecord(void) {
+    if (dogmHost_recordCount() != testFlush_expectedCount) {
+        return 0;
+    }
+    return memcmp(testFlush_expected, dogmHost_record(), testFlush_expectedCount * sizeof(dogmHost_byte_t)) ? 0 : 1;
+}
+
+static void testFlush_init(void) {
+    dogmHost_clear();
+    dogm_init();
+
+    const dogmHost_byte_t* record = dogmHost_record();
+    uint16_t count = dogmHost_recordCount();
+    TEST_CHECK(count == 17);
+    TEST_CHECK(record[0].type == DOGM_HOST_RESET);
+    TEST_CHECK(record[1].value == (DOGM_START_LINE | 0));
+    TEST_CHECK(record[count - 3].value == DOGM_PAGE_ADDR_CMD(0));
+    TEST_CHECK(record[count - 1].value == DOGM_COLUMN_ADDR_CMD_LOW(0));
+    TEST_CHECK(test_dataBytes() == 0);
+    TEST_CHECK(dogmHost_lostBytes() == 0);
+}
+
+static void testFlush_singleDot(void) {
+    test_resetDisplay();
+    dogmGraphic_drawDot(10, 10);
+    dogmGraphic_flushRam(NULL);
+
+    // page and column address, then one data byte
+    const dogmHost_byte_t* record = dogmHost_record();
+    TEST_CHECK(dogmHost_recordCount() == 4);
+    TEST_CHECK(record[0].type == DOGM_HOST_COMMAND && record[0].value == DOGM_PAGE_ADDR_CMD(1));
+    TEST_CHECK(record[1].type == DOGM_HOST_COMMAND && record[1].value == DOGM_COLUMN_ADDR_CMD_HIGH(10));
+    TEST_CHECK(record[2].type == DOGM_HOST_COMMAND && record[2].value == DOGM_COLUMN_ADDR_CMD_LOW(10));
+    TEST_CHECK(record[3].type == DOGM_HOST_DATA && record[3].value == 0x04);
+    TEST_CHECK(dogmGraphic_newContent.value == 0);
+}
+
+static void testFlush_asyncEqualsBlocking(void) {
+    test_resetDisplay();
+    test_drawScene();
+    dogmGraphic_flushRam(NULL);
+    testFlush_keepRecord();
+    TEST_CHECK(testFlush_expectedCount > 0);
+
+    test_resetDisplay();
+    test_drawScene();
+    TEST_CHECK(dogmGraphic_flushRamAsyncStart() == 1);
+    TEST_CHECK(!dogmGraphic_flushRamAsyncDone());
+    TEST_CHECK(dogmGraphic_flushRamAsyncStart() == 0);
+    dogmHost_runInterrupts();
+
+    TEST_CHECK(dogmGraphic_flushRamAsyncDone());
+    TEST_CHECK(dogmGraphic_flushRamAsyncPending() == 0);
+    TEST_CHECK(!dogmHost_pins.select);
+    TEST_CHECK(testFlush_equalsKeptRecord());
+}
+
+static void testFlush_stepBudget(void) {
+    const uint16_t budget = 20;
+
+    test_resetDisplay();
+    test_drawScene();
+    dogmGraphic_flushRam(NULL);
+    uint16_t dataBytes = test_dataBytes();
+
+    test_resetDisplay();
+    test_drawScene();
+    uint8_t done = 0;
+    uint16_t steps = 0;
+    uint16_t sent = 0;
+    while (!done && steps < 1000) {
+        done = dogmGraphic_flushStep(budget);
+        TEST_CHECK(dogmHost_recordCount() - sent <= budget);
+        sent = dogmHost_recordCount();
+        steps++;
+    }
+
+    TEST_CHECK(done);
+    TEST_CHECK(steps > 1);
+    TEST_CHECK(test_dataBytes() == dataBytes);
+    TEST_CHECK(dogmGraphic_flushStep(budget) == 1);
+}
+
+static void testFlush_stepCompletedByFlushRam(void) {
+    test_resetDisplay();
+    test_drawScene();
+    dogmGraphic_flushRam(NULL);
+    uint16_t dataBytes = test_dataBytes();
+
+    test_resetDisplay();
+    test_drawScene();
+    TEST_CHECK(dogmGraphic_flushStep(10) == 0);
+    TEST_CHECK(dogmGraphic_flushRamAsyncStart() == 0);
+    dogmGraphic_flushRam(NULL);
+
+    TEST_CHECK(dogmGraphic_flushRamAsyncDone());
+    TEST_CHECK(test_dataBytes() == dataBytes);
+}
+
+static void testFlush_redrawEqualContent(void) {
+    test_resetDisplay();
+    test_drawScene();
+    dogmGraphic_flushRam(NULL);
+    dogmHost_clear();
+
+    test_drawScene();
+    dogmGraphic_flushRam(NULL);
+#if DOGM_USE_SHADOW_RAM
+    // nothing differs from the last sent bytes
+    TEST_CHECK(dogmHost_recordCount() == 0);
+#else
+    TEST_CHECK(test_dataBytes() > 0);
+#endif
+}
+
+void testFlush_run(void) {
+    TEST_RUN(testFlush_init);
+    TEST_RUN(testFlush_singleDot);
+    TEST_RUN(testFlush_asyncEqualsBlocking);
+    TEST_RUN(testFlush_stepBudget);
+    TEST_RUN(testFlush_stepCompletedByFlushRam);
+    TEST_RUN(testFlush_redrawEqualContent);
+}
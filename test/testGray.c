@@ -0,0 +1,172 @@
+/*! @file testGray.c
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+
+#include <string.h>
+#include "test.h"
+#include "../lcd_src/drawing/drawingInclude.h"
+
+#if DOGM_GRAY_PLANES
+/*! @brief columns of the areas drawn by testGray_drawLevels, the last one is only drawn in display_content
+ */
+#define TEST_GRAY_AREAS     (DOGM_GRAY_LEVELS + 1)
+
+/*! @brief draw one area per gray level and one black area beside the gray columns
+ */
+static void testGray_drawLevels(void) {
+    for (uint8_t level = 0; level < DOGM_GRAY_LEVELS; level++) {
+        dogmGraphic_drawGrayArea((uint8_t) (level * 10), 8, 10, 16, level);
+    }
+    dogmGraphic_drawArea(100, 8, 10, 16, DOGM_ADD);
+}
+
+/*! @brief count the frames of whole grayscale cycles, in which the areas of testGray_drawLevels are black
+ *
+ * @return  number of sent frames
+ */
+static uint8_t testGray_cycles(uint8_t cycles, uint8_t y, uint8_t counts[TEST_GRAY_AREAS]) {
+    uint8_t sent = 0;
+    memset(counts, 0, TEST_GRAY_AREAS);
+    for (uint8_t frame = 0; frame < cycles * DOGM_GRAY_FRAMES; frame++) {
+        sent += dogmGraphic_grayTick();
+        for (uint8_t i = 0; i < DOGM_GRAY_LEVELS; i++) {
+            counts[i] += dogmEmu_pixel((uint8_t) (i * 10 + 5), y);
+        }
+        counts[DOGM_GRAY_LEVELS] += dogmEmu_pixel(105, y);
+    }
+    return sent;
+}
+
+static void testGray_levels(void) {
+    uint8_t counts[TEST_GRAY_AREAS];
+    test_resetDisplay();
+    testGray_drawLevels();
+    dogmGraphic_grayStart();
+    dogmEmu_startFrame();
+
+    // every level is black in as many frames of a cycle, display_content is skipped, when it is shown twice in a row
+    TEST_CHECK(testGray_cycles(2, 12, counts) == 2 * (DOGM_GRAY_FRAMES - 1));
+    for (uint8_t level = 0; level < DOGM_GRAY_LEVELS; level++) {
+        TEST_CHECK(counts[level] == 2 * level);
+    }
+    TEST_CHECK(counts[DOGM_GRAY_LEVELS] == 2 * DOGM_GRAY_FRAMES);
+
+    // only the gray columns of their two pages are sent
+    TEST_CHECK(dogmEmu_frame()->data == 2 * (DOGM_GRAY_FRAMES - 1) * 2 * DOGM_GRAY_LEVELS * 10);
+
+    // one pixel in the lowest plane only
+    dogmGraphic_drawToPlane(0);
+    dogmGraphic_drawDot(2, 40);
+    dogmGraphic_drawToPlane(DOGM_GRAY_PLANES - 1);
+    TEST_CHECK(dogmGraphic_display->gray[0][5][2] == 0x01);
+    TEST_CHECK(display_content[5][2] == 0x00);
+    uint8_t black = 0;
+    for (uint8_t frame = 0; frame < DOGM_GRAY_FRAMES; frame++) {
+        dogmGraphic_grayTick();
+        black += dogmEmu_pixel(2, 40);
+    }
+    TEST_CHECK(black == 1);
+
+    dogmGraphic_grayStop();
+    dogmGraphic_flushRam(NULL);
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+}
+
+static void testGray_changes(void) {
+    uint8_t counts[TEST_GRAY_AREAS];
+    test_resetDisplay();
+    testGray_drawLevels();
+    dogmGraphic_grayStart();
+
+    // the flush does nothing, the next frame sends the change
+    dogmGraphic_drawArea(90, 40, 10, 8, DOGM_ADD);
+    dogmEmu_startFrame();
+    dogmGraphic_flushRam(NULL);
+    TEST_CHECK(dogmEmu_frame()->bytes == 0);
+    TEST_CHECK(dogmGraphic_grayTick());
+    TEST_CHECK(dogmEmu_pixel(95, 44));
+
+    // all planes scroll together
+    dogmGraphic_scroll(-5);
+    testGray_cycles(1, 17, counts);
+    TEST_CHECK(dogmEmu_state()->startLine == dogmGraphic_getScrollOffset());
+    for (uint8_t level = 0; level < DOGM_GRAY_LEVELS; level++) {
+        TEST_CHECK(counts[level] == level);
+    }
+    TEST_CHECK(counts[DOGM_GRAY_LEVELS] == DOGM_GRAY_FRAMES);
+
+    // without the lower planes, display_content is shown in every frame
+    dogmGraphic_clearGray();
+    testGray_cycles(1, 17, counts);
+    for (uint8_t level = 0; level < DOGM_GRAY_LEVELS; level++) {
+        TEST_CHECK(counts[level] == ((level >> (DOGM_GRAY_PLANES - 1)) ? DOGM_GRAY_FRAMES : 0));
+    }
+    dogmEmu_startFrame();
+    testGray_cycles(1, 17, counts);
+    TEST_CHECK(dogmEmu_frame()->bytes == 0);
+
+    dogmGraphic_grayStop();
+    dogmGraphic_flushRam(NULL);
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+}
+
+static void testGray_stopAndClear(void) {
+    test_resetDisplay();
+    dogmGraphic_grayStart();
+
+    // drawn and sent while the grayscale mode runs, cleared after it stopped
+    dogmGraphic_drawArea(20, 10, 40, 16, DOGM_ADD);
+    TEST_CHECK(dogmGraphic_grayTick());
+    TEST_CHECK(dogmEmu_pixel(30, 20));
+    dogmGraphic_grayStop();
+    dogmGraphic_drawArea(20, 10, 40, 16, DOGM_CLEAR);
+    dogmGraphic_flushRam(NULL);
+    TEST_CHECK(!dogmEmu_pixel(30, 20));
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+
+    // the same with a lower bit-plane shown at the stop
+    testGray_drawLevels();
+    dogmGraphic_grayStart();
+    dogmGraphic_grayTick();
+    dogmGraphic_grayStop();
+    dogmGraphic_clearGray();
+    dogmGraphic_clearWholeDisplay();
+    dogmGraphic_flushRam(NULL);
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+}
+#endif
+
+void testGray_run(void) {
+#if DOGM_GRAY_PLANES
+    TEST_RUN(testGray_levels);
+    TEST_RUN(testGray_changes);
+    TEST_RUN(testGray_stopAndClear);
+#endif
+}
@@ -0,0 +1,170 @@
+/*! @file testScroll.c
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+
+
+#include <string.h>
+#include "test.h"
+#include "../lcd_src/drawing/drawingInclude.h"
+
+static uint8_t testScroll_expected[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+static uint8_t testScroll_panel[DOGM_DISPLAY_PAGES][DOGM_DISPLAY_WIDTH];
+
+/*! @brief draw images and areas, which wrap around the end of the ram at offset 27
+ */
+static void testScroll_drawWrapped(void) {
+    test_drawScene();
+    test_drawSceneChange();
+    dogmGraphic_drawArea(10, 30, 100, 10, DOGM_INVERT);
+    draw_font_setCursorXY(70, 35);
+    draw_font_stringP(DOGM_INVERT, PSTR("wrap"));
+    draw_font_setCursorXY(4, 33);
+    draw_font_stringP(DOGM_ADD, PSTR("add"));
+}
+
+static void testScroll_onePage(void) {
+    test_resetDisplay();
+    test_drawScene();
+    dogmGraphic_flushRam(NULL);
+    dogmEmu_panel(testScroll_expected);
+    dogmEmu_startFrame();
+
+    dogmGraphic_scroll(8);
+    dogmGraphic_flushRam(NULL);
+
+    // only the exposed page and the start line are sent
+    TEST_CHECK(dogmGraphic_getScrollOffset() == 8);
+    TEST_CHECK(dogmEmu_state()->startLine == 8);
+    TEST_CHECK(dogmEmu_frame()->data <= DOGM_DISPLAY_WIDTH);
+    TEST_CHECK(dogmEmu_frame()->commands == dogmEmu_frame()->addressCommands + 1);
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+
+    dogmEmu_panel(testScroll_panel);
+    TEST_CHECK(memcmp(testScroll_panel[0], testScroll_expected[1],
+                      (DOGM_DISPLAY_PAGES - 1) * DOGM_DISPLAY_WIDTH) == 0);
+    for (uint8_t x = 0; x < DOGM_DISPLAY_WIDTH; x++) {
+        TEST_CHECK(testScroll_panel[DOGM_DISPLAY_PAGES - 1][x] == 0);
+    }
+}
+
+static void testScroll_wrappedDrawing(void) {
+    test_resetDisplay();
+    testScroll_drawWrapped();
+    dogmGraphic_flushRam(NULL);
+    dogmEmu_panel(testScroll_expected);
+
+    for (uint8_t method = 0; method < 3; method++) {
+        test_resetDisplay();
+        dogmGraphic_scroll(-37);
+        dogmGraphic_flushRam(NULL);
+        TEST_CHECK(dogmGraphic_getScrollOffset() == 27);
+
+        testScroll_drawWrapped();
+        switch (method) {
+            case 0:
+                dogmGraphic_flushRam(NULL);
+                break;
+            case 1:
+                dogmGraphic_flushRamAsyncStart();
+                dogmHost_runInterrupts();
+                break;
+            default:
+                while (!dogmGraphic_flushStep(20));
+        }
+
+        TEST_CHECK(dogmEmu_state()->startLine == 27);
+        TEST_CHECK(dogmEmu_diffRam() == 0);
+        dogmEmu_panel(testScroll_panel);
+        TEST_CHECK(memcmp(testScroll_expected, testScroll_panel, sizeof(testScroll_expected)) == 0);
+    }
+}
+
+static void testScroll_onlyStartLine(void) {
+    test_resetDisplay();
+
+    // scrolling an empty display changes nothing but the start line
+    dogmGraphic_scroll(5);
+    dogmGraphic_scroll(-2);
+    TEST_CHECK(dogmGraphic_getScrollOffset() == 3);
+    dogmGraphic_flushRam(NULL);
+    TEST_CHECK(dogmEmu_state()->startLine == 3);
+
+    dogmGraphic_scroll(1);
+    while (!dogmGraphic_flushStep(1));
+    TEST_CHECK(dogmEmu_state()->startLine == 4);
+
+    dogmGraphic_scroll(-4);
+    dogmGraphic_flushRamAsyncStart();
+    dogmHost_runInterrupts();
+    TEST_CHECK(dogmEmu_state()->startLine == 0);
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+
+    // a scroll over the whole height only clears the display
+    dogmGraphic_drawDot(3, 3);
+    dogmGraphic_scroll(-DOGM_DISPLAY_HEIGHT);
+    TEST_CHECK(dogmGraphic_getScrollOffset() == 0);
+    dogmGraphic_flushRam(NULL);
+    TEST_CHECK(!dogmEmu_pixel(3, 3));
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+}
+
+static void testScroll_flushDuringStartLine(void) {
+    const uint8_t startLine = DOGM_START_LINE | 6;
+    test_resetDisplay();
+    dogmGraphic_scroll(6);
+    dogmGraphic_drawDot(3, 3);
+
+    // serve the interrupts up to the start line, it is still on the wire then
+    TEST_CHECK(dogmGraphic_flushRamAsyncStart());
+    while ((dogmHost_recordCount() == 0) || (dogmHost_record()[dogmHost_recordCount() - 1].value != startLine) ||
+           (dogmHost_record()[dogmHost_recordCount() - 1].type != DOGM_HOST_COMMAND)) {
+        dogmHost_pins.transferComplete = 0;
+        DOGM_SPI_ISR();
+    }
+    TEST_CHECK(!dogmGraphic_flushRamAsyncDone());
+
+    // the blocking flush waits for the end of the asynchronous one, before it selects the display again
+    dogmGraphic_drawDot(10, 10);
+    dogmGraphic_flushRam(NULL);
+    TEST_CHECK(dogmGraphic_flushRamAsyncDone());
+    dogmHost_runInterrupts();
+    TEST_CHECK(dogmHost_lostBytes() == 0);
+    TEST_CHECK(dogmEmu_state()->startLine == 6);
+    TEST_CHECK(dogmEmu_pixel(3, 3));
+    TEST_CHECK(dogmEmu_pixel(10, 10));
+    TEST_CHECK(dogmEmu_diffRam() == 0);
+}
+
+void testScroll_run(void) {
+    TEST_RUN(testScroll_onePage);
+    TEST_RUN(testScroll_wrappedDrawing);
+    TEST_RUN(testScroll_flushDuringStartLine);
+    TEST_RUN(testScroll_onlyStartLine);
+}
@@ -0,0 +1,522 @@
+/*! @file dogmAsset.cpp
+ *
+ * @author Maximilian Blase
+ * @date 2026-10-17
+ *
+ * #####################################################################################################################
+ * @Copyright (c) 2026, M.Blase, info@maximilian-blase.de
+ * All rights reserved.
+ *
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ * following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * #####################################################################################################################
+ */
+
+
+
+/*
+ * Host tool, that compiles images into imageData_t definitions for the flash memory.
+ *
+ * dogm-asset [options] -o <output> <images>...
+ *
+ *  -o, --output <path>     path of the generated files without extension, <path>.c and <path>.h
+ *  -I, --include <header>  header with imageData_t, default drawingFigures.h
+ *  -t, --threshold <0-255> gray values below the threshold are set pixels, default 128
+ *  -d, --dither            Floyd-Steinberg dithering at the threshold instead of a hard cut
+ *  -i, --invert            set the light pixels instead of the dark ones
+ *  -r, --rle               store run length encoded, if it is smaller than the raw data
+ *
+ * The images are PBM or PGM files, plain or binary. The name of an image is its file name without extension. The images
+ * are converted by a worker thread per cpu and images with the same data share one array.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// codes of run length encoded bitmaps, see DOGM_RLE_LITERAL in dogm128-graphic.h
+#define DOGM_RLE_LITERAL    0x00
+#define DOGM_RLE_ZEROS      0x40
+#define DOGM_RLE_ONES       0x80
+#define DOGM_RLE_REPEAT     0xC0
+#define DOGM_RLE_COUNT      0x3F
+
+namespace {
+
+/*! @brief options of the command line
+ */
+struct options_t {
+    std::string output;
+    std::string include = "drawingFigures.h";
+    int threshold = 128;
+    bool dither = false;
+    bool invert = false;
+    bool rle = false;
+    std::vector<std::string> images;
+};
+
+/*! @brief one image of the output
+ *
+ * @param path      file of the image
+ * @param name      c name of the imageData_t
+ * @param width     width in pixel
+ * @param height    height in pixel
+ * @param pages     page organized bytes like the display ram
+ * @param encoded   run length encoded pages, empty if the raw pages are stored
+ * @param error     message of a failed conversion
+ */
+struct asset_t {
+    std::string path;
+    std::string name;
+    unsigned width = 0;
+    unsigned height = 0;
+    std::vector<uint8_t> pages;
+    std::vector<uint8_t> encoded;
+    std::string error;
+};
+
+/*! @brief gray image, 0 is black and 255 is white
+ */
+struct grayImage_t {
+    unsigned width = 0;
+    unsigned height = 0;
+    std::vector<uint8_t> gray;
+};
+
+/*! @brief skip white space and comments of a netpbm header
+ */
+void skipSpace(std::istream &in) {
+    int c;
+    while ((c = in.peek()) != EOF) {
+        if (c == '#') {
+            std::string comment;
+            std::getline(in, comment);
+        }
+        else if (std::isspace(c)) {
+            in.get();
+        }
+        else {
+            break;
+        }
+    }
+}
+
+/*! @brief read a decimal number of a netpbm file
+ */
+unsigned readNumber(std::istream &in, const char *what) {
+    skipSpace(in);
+    unsigned value;
+    if (!(in >> value)) {
+        throw std::runtime_error(std::string("missing ") + what);
+    }
+    return value;
+}
+
+/*! @brief read a PBM or PGM file, plain or binary
+ */
+grayImage_t readNetpbm(const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("can not open the file");
+    }
+    char magic[2] = {0, 0};
+    in.read(magic, 2);
+    if ((magic[0] != 'P') || (magic[1] < '1') || (magic[1] == '3') || (magic[1] > '5')) {
+        throw std::runtime_error("no PBM or PGM file");
+    }
+    bool bitmap = (magic[1] == '1') || (magic[1] == '4');
+    bool binary = (magic[1] == '4') || (magic[1] == '5');
+
+    grayImage_t image;
+    image.width = readNumber(in, "width");
+    image.height = readNumber(in, "height");
+    unsigned maximum = bitmap ? 1 : readNumber(in, "maximum gray value");
+    if (!image.width || !image.height || (image.width > 255) || (image.height > 255)) {
+        throw std::runtime_error("the size has to be 1 to 255 pixel");
+    }
+    if (!maximum || (maximum > 65535)) {
+        throw std::runtime_error("the maximum gray value has to be 1 to 65535");
+    }
+    image.gray.resize(image.width * image.height);
+
+    if (binary) {
+        // a single white space character ends the header
+        in.get();
+    }
+    if (bitmap && binary) {
+        // rows of bits, the first pixel in the high bit, 1 is black
+        unsigned rowBytes = (image.width + 7) / 8;
+        std::vector<uint8_t> row(rowBytes);
+        for (unsigned y = 0; y < image.height; y++) {
+            if (!in.read(reinterpret_cast<char *>(row.data()), rowBytes)) {
+                throw std::runtime_error("the pixel data is too short");
+            }
+            for (unsigned x = 0; x < image.width; x++) {
+                bool black = (row[x >> 3] >> (7 - (x & 0x07))) & 0x01;
+                image.gray[y * image.width + x] = black ? 0 : 255;
+            }
+        }
+    }
+    else if (bitmap) {
+        // the digits of a plain bitmap may follow each other without white space
+        for (uint8_t &pixel : image.gray) {
+            skipSpace(in);
+            int c = in.get();
+            if ((c != '0') && (c != '1')) {
+                throw std::runtime_error("the pixel data is too short");
+            }
+            pixel = (c == '1') ? 0 : 255;
+        }
+    }
+    else {
+        for (uint8_t &pixel : image.gray) {
+            unsigned value;
+            if (binary) {
+                int high = (maximum > 255) ? in.get() : 0;
+                int low = in.get();
+                if ((high == EOF) || (low == EOF)) {
+                    throw std::runtime_error("the pixel data is too short");
+                }
+                value = (unsigned) ((high << 8) | low);
+            }
+            else {
+                value = readNumber(in, "pixel data");
+            }
+            if (value > maximum) {
+                throw std::runtime_error("a pixel is above the maximum gray value");
+            }
+            pixel = (uint8_t) ((value * 255 + maximum / 2) / maximum);
+        }
+    }
+    return image;
+}
+
+/*! @brief convert a gray image to pages, a set bit is a dark pixel
+ */
+std::vector<uint8_t> toPages(const grayImage_t &image, const options_t &options) {
+    unsigned pageCount = (image.height + 7) / 8;
+    std::vector<uint8_t> pages(pageCount * image.width, 0);
+    std::vector<int> level(image.gray.begin(), image.gray.end());
+    if (options.invert) {
+        for (int &value : level) {
+            value = 255 - value;
+        }
+    }
+
+    for (unsigned y = 0; y < image.height; y++) {
+        for (unsigned x = 0; x < image.width; x++) {
+            int value = level[y * image.width + x];
+            bool set = value < options.threshold;
+            if (options.dither) {
+                // spread the error to the pixels right and below
+                int error = value - (set ? 0 : 255);
+                if (x + 1 < image.width) {
+                    level[y * image.width + x + 1] += error * 7 / 16;
+                }
+                if (y + 1 < image.height) {
+                    if (x > 0) {
+                        level[(y + 1) * image.width + x - 1] += error * 3 / 16;
+                    }
+                    level[(y + 1) * image.width + x] += error * 5 / 16;
+                    if (x + 1 < image.width) {
+                        level[(y + 1) * image.width + x + 1] += error / 16;
+                    }
+                }
+            }
+            if (set) {
+                pages[(y >> 3) * image.width + x] |= (uint8_t) (1 << (y & 0x07));
+            }
+        }
+    }
+    return pages;
+}
+
+/*! @brief run length encode page data
+ *
+ * Runs of 0x00 and 0xFF are always taken, other bytes make a run from three on. All bytes between them are literals.
+ */
+std::vector<uint8_t> encodeRle(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> encoded;
+    size_t size = data.size();
+    size_t i = 0;
+    while (i < size) {
+        size_t run = 1;
+        while ((i + run < size) && (run <= DOGM_RLE_COUNT) && (data[i + run] == data[i])) {
+            run++;
+        }
+        if ((data[i] == 0x00) || (data[i] == 0xFF)) {
+            encoded.push_back((uint8_t) ((data[i] ? DOGM_RLE_ONES : DOGM_RLE_ZEROS) | (run - 1)));
+        }
+        else if (run >= 3) {
+            encoded.push_back((uint8_t) (DOGM_RLE_REPEAT | (run - 1)));
+            encoded.push_back(data[i]);
+        }
+        else {
+            size_t code = encoded.size();
+            encoded.push_back(0);
+            run = 0;
+            while ((i + run < size) && (run <= DOGM_RLE_COUNT) && (data[i + run] != 0x00) &&
+                   (data[i + run] != 0xFF) &&
+                   !((i + run + 2 < size) && (data[i + run + 1] == data[i + run]) &&
+                     (data[i + run + 2] == data[i + run]))) {
+                encoded.push_back(data[i + run]);
+                run++;
+            }
+            encoded[code] = (uint8_t) (DOGM_RLE_LITERAL | (run - 1));
+        }
+        i += run;
+    }
+    return encoded;
+}
+
+/*! @brief c name of an image from its file name
+ */
+std::string nameOf(const std::string &path) {
+    size_t start = path.find_last_of("/\\");
+    start = (start == std::string::npos) ? 0 : start + 1;
+    size_t end = path.find('.', start);
+    std::string name = path.substr(start, (end == std::string::npos) ? std::string::npos : end - start);
+    for (char &c : name) {
+        if (!std::isalnum((unsigned char) c)) {
+            c = '_';
+        }
+    }
+    if (name.empty() || std::isdigit((unsigned char) name[0])) {
+        name.insert(0, "_");
+    }
+    return name;
+}
+
+/*! @brief convert one image
+ */
+void convert(asset_t &asset, const options_t &options) {
+    try {
+        grayImage_t image = readNetpbm(asset.path);
+        asset.width = image.width;
+        asset.height = image.height;
+        asset.pages = toPages(image, options);
+        if (options.rle) {
+            std::vector<uint8_t> encoded = encodeRle(asset.pages);
+            if (encoded.size() < asset.pages.size()) {
+                asset.encoded.swap(encoded);
+            }
+        }
+    }
+    catch (const std::exception &exception) {
+        asset.error = exception.what();
+    }
+}
+
+/*! @brief convert all images, by one worker thread per cpu
+ */
+void convertAll(std::vector<asset_t> &assets, const options_t &options) {
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min<unsigned>(threads, (unsigned) assets.size());
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threads; i++) {
+        workers.emplace_back([&assets, &options, &next]() {
+            for (size_t index = next++; index < assets.size(); index = next++) {
+                convert(assets[index], options);
+            }
+        });
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+}
+
+/*! @brief write the bytes of an array, 16 in a line
+ */
+void writeBytes(std::ostream &out, const std::vector<uint8_t> &bytes) {
+    char hex[8];
+    for (size_t i = 0; i < bytes.size(); i++) {
+        if (!(i % 16)) {
+            out << "       ";
+        }
+        std::snprintf(hex, sizeof(hex), " 0x%02X,", bytes[i]);
+        out << hex;
+        if (((i % 16) == 15) || (i + 1 == bytes.size())) {
+            out << "\n";
+        }
+    }
+}
+
+/*! @brief write the header and the source file
+ */
+void writeOutput(const std::vector<asset_t> &assets, const options_t &options) {
+    size_t slash = options.output.find_last_of("/\\");
+    std::string base = options.output.substr((slash == std::string::npos) ? 0 : slash + 1);
+    std::string guard = "DOGM_ASSETS_" + nameOf(base) + "_H";
+    std::transform(guard.begin(), guard.end(), guard.begin(), [](char c) { return (char) std::toupper(c); });
+
+    std::ofstream header(options.output + ".h");
+    header << "/*! @file " << base << ".h\n"
+           << " *\n"
+           << " * generated by dogm-asset from " << assets.size() << " images, do not edit\n"
+           << " */\n\n"
+           << "#ifndef " << guard << "\n"
+           << "#define " << guard << "\n\n"
+           << "#include \"" << options.include << "\"\n\n";
+    for (const asset_t &asset : assets) {
+        header << "extern const imageData_t " << asset.name << ";\n";
+    }
+    header << "\n#endif //" << guard << "\n";
+
+    // images with the same size and pages share the array of the first one
+    std::ofstream source(options.output + ".c");
+    source << "/*! @file " << base << ".c\n"
+           << " *\n"
+           << " * generated by dogm-asset from " << assets.size() << " images, do not edit\n"
+           << " */\n\n"
+           << "#include \"" << base << ".h\"\n";
+    std::map<std::vector<uint8_t>, const asset_t *> arrays;
+    size_t rawBytes = 0;
+    size_t storedBytes = 0;
+    for (const asset_t &asset : assets) {
+        std::vector<uint8_t> key = asset.pages;
+        key.push_back((uint8_t) asset.width);
+        key.push_back((uint8_t) asset.height);
+        const asset_t *&first = arrays[key];
+        const std::vector<uint8_t> &stored = asset.encoded.empty() ? asset.pages : asset.encoded;
+        const char *format = asset.encoded.empty() ? "DOGM_BITMAP_RAW" : "DOGM_BITMAP_RLE";
+        rawBytes += asset.pages.size();
+
+        size_t file = asset.path.find_last_of("/\\");
+        source << "\n// " << asset.path.substr((file == std::string::npos) ? 0 : file + 1) << ", " << asset.width << "x" << asset.height;
+        if (first) {
+            source << ", the same data as " << first->name << "\n";
+        }
+        else {
+            first = &asset;
+            storedBytes += stored.size();
+            source << ", " << asset.pages.size() << " bytes";
+            if (!asset.encoded.empty()) {
+                source << " run length encoded to " << asset.encoded.size();
+            }
+            source << "\nstatic const uint8_t " << asset.name << "_data[] PROGMEM = {\n";
+            writeBytes(source, stored);
+            source << "};\n";
+        }
+        source << "const imageData_t " << asset.name << " = {" << first->name << "_data, " << asset.width << ", "
+               << asset.height << ", " << format << "};\n";
+    }
+
+    if (!header || !source) {
+        throw std::runtime_error("can not write " + options.output + ".c or .h");
+    }
+    std::printf("dogm-asset: %s, %zu images, %zu arrays, %zu bytes of pages stored in %zu bytes\n", base.c_str(),
+                assets.size(), arrays.size(), rawBytes, storedBytes);
+}
+
+/*! @brief parse the command line
+ */
+options_t parseOptions(int argc, char **argv) {
+    options_t options;
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+        bool hasValue = i + 1 < argc;
+        if ((argument == "-o") || (argument == "--output")) {
+            if (!hasValue) {
+                throw std::runtime_error(argument + " needs a path");
+            }
+            options.output = argv[++i];
+        }
+        else if ((argument == "-I") || (argument == "--include")) {
+            if (!hasValue) {
+                throw std::runtime_error(argument + " needs a header");
+            }
+            options.include = argv[++i];
+        }
+        else if ((argument == "-t") || (argument == "--threshold")) {
+            char *end = nullptr;
+            long threshold = hasValue ? std::strtol(argv[++i], &end, 10) : -1;
+            if (!end || *end || (threshold < 0) || (threshold > 255)) {
+                throw std::runtime_error(argument + " needs a value from 0 to 255");
+            }
+            options.threshold = (int) threshold;
+        }
+        else if ((argument == "-d") || (argument == "--dither")) {
+            options.dither = true;
+        }
+        else if ((argument == "-i") || (argument == "--invert")) {
+            options.invert = true;
+        }
+        else if ((argument == "-r") || (argument == "--rle")) {
+            options.rle = true;
+        }
+        else if (!argument.empty() && (argument[0] == '-')) {
+            throw std::runtime_error("unknown option " + argument);
+        }
+        else {
+            options.images.push_back(argument);
+        }
+    }
+    if (options.output.empty() || options.images.empty()) {
+        throw std::runtime_error("usage: dogm-asset [-t threshold] [-d] [-i] [-r] [-I header] -o output images...");
+    }
+    return options;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    try {
+        options_t options = parseOptions(argc, argv);
+
+        std::vector<asset_t> assets(options.images.size());
+        std::map<std::string, std::string> names;
+        for (size_t i = 0; i < assets.size(); i++) {
+            assets[i].path = options.images[i];
+            assets[i].name = nameOf(options.images[i]);
+            std::string &other = names[assets[i].name];
+            if (!other.empty()) {
+                throw std::runtime_error(assets[i].path + " has the same name as " + other);
+            }
+            other = assets[i].path;
+        }
+
+        convertAll(assets, options);
+        bool failed = false;
+        for (const asset_t &asset : assets) {
+            if (!asset.error.empty()) {
+                std::fprintf(stderr, "dogm-asset: %s: %s\n", asset.path.c_str(), asset.error.c_str());
+                failed = true;
+            }
+        }
+        if (failed) {
+            return 1;
+        }
+        writeOutput(assets, options);
+    }
+    catch (const std::exception &exception) {
+        std::fprintf(stderr, "dogm-asset: %s\n", exception.what());
+        return 1;
+    }
+    return 0;
+}